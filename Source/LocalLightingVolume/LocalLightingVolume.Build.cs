@@ -26,6 +26,7 @@ public class LocalLightingVolume : ModuleRules
 			new string[]
 			{
 				"Core",
+				"LocalLightingVolumeCore",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -36,6 +37,10 @@ public class LocalLightingVolume : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"LevelSequence",
+				"MovieScene",
+				"NavigationSystem",
+				"RenderCore",
 				"Slate",
 				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
@@ -43,6 +48,11 @@ public class LocalLightingVolume : ModuleRules
 			);
 		
 		
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("TargetPlatform");
+		}
+		
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
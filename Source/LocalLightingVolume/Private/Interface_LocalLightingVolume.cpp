@@ -9,10 +9,120 @@
 #include "Interface_LocalLightingVolume.h"
 
 // Engine Include
-#include "UObject/ObjectSaveContext.h"
+#include "Components/BrushComponent.h"
+#include "Engine/Polys.h"
+#include "HAL/IConsoleManager.h"
+#include "Model.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Scalability.h"
+#if WITH_EDITOR
+#include "Interfaces/ITargetPlatform.h"
+#endif
 
 // Plugins Include
+#include "LocalLightingOverrideDiff.h"
 #include "LocalLightingSubsystem.h"
+#include "LocalLightingVolume.h"
+#include "LocalLightingVolumeInstancesComponent.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Brush Volumes"), STAT_LocalLightingVolume_NumBrushVolumes, STATGROUP_LocalLightingVolume);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Analytic Volumes"), STAT_LocalLightingVolume_NumAnalyticVolumes, STATGROUP_LocalLightingVolume);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Register Components Brush (ms)"), STAT_LocalLightingVolume_RegisterBrushMs, STATGROUP_LocalLightingVolume);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Register Components Analytic (ms)"), STAT_LocalLightingVolume_RegisterAnalyticMs, STATGROUP_LocalLightingVolume);
+
+static int32 GetScalabilityQualityLevel(ELocalLightingScalabilityGroup Group)
+{
+	const Scalability::FQualityLevels QualityLevels = Scalability::GetQualityLevels();
+	switch (Group)
+	{
+	case ELocalLightingScalabilityGroup::ViewDistance:
+		return QualityLevels.ViewDistanceQuality;
+	case ELocalLightingScalabilityGroup::Shadow:
+		return QualityLevels.ShadowQuality;
+	case ELocalLightingScalabilityGroup::GlobalIllumination:
+		return QualityLevels.GlobalIlluminationQuality;
+	case ELocalLightingScalabilityGroup::Reflection:
+		return QualityLevels.ReflectionQuality;
+	case ELocalLightingScalabilityGroup::PostProcess:
+		return QualityLevels.PostProcessQuality;
+	case ELocalLightingScalabilityGroup::Effects:
+		return QualityLevels.EffectsQuality;
+	default:
+		return Scalability::DefaultQualityLevel;
+	}
+}
+
+static int32 FindScalabilityVariant(const TArray<FLocalLightingScalabilityVariant>& Variants, int32 QualityLevel)
+{
+	int32 VariantIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Variants.Num(); Index++)
+	{
+		if (QualityLevel <= Variants[Index].MaxQualityLevel && (VariantIndex == INDEX_NONE || Variants[Index].MaxQualityLevel < Variants[VariantIndex].MaxQualityLevel))
+		{
+			VariantIndex = Index;
+		}
+	}
+	return VariantIndex;
+}
+
+#if WITH_EDITOR
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeEditorInteractiveEditRate(
+	TEXT("r.LocalLightingVolume.Editor.InteractiveEditRate"),
+	10.0f,
+	TEXT("Rate in Hz at which the changes of a Volume property dragged in the editor are applied to its target.\n")
+	TEXT("The committed value is always applied. 0 applies every change."),
+	ECVF_Default);
+#endif
+
+/** Next value of ALocalLightingVolumeBase::EnterOrder, shared by every World since only the relative order matters. */
+static uint32 GNextVolumeEnterOrder = 1;
+
+/** Transient property caching the value overridden by the named override, CacheX or bCacheX. */
+static const FProperty* FindCacheProperty(const UClass* Class, FName OverrideName)
+{
+	const FString Name = OverrideName.ToString();
+	if (const FProperty* Property = Class->FindPropertyByName(FName(*(TEXT("Cache") + Name))))
+	{
+		return Property;
+	}
+	const bool bBoolName = Name.Len() > 1 && Name[0] == TEXT('b') && FChar::IsUpper(Name[1]);
+	return Class->FindPropertyByName(FName(*(TEXT("bCache") + (bBoolName ? Name.RightChop(1) : Name))));
+}
+
+#if WITH_EDITOR
+/**
+ * Remove the variants the cooked platform never selects.
+ * The quality levels its device profiles run at are read from the [LocalLightingVolume] section of its Engine ini,
+ * CookedMinQualityLevel and CookedMaxQualityLevel, every level being kept by default.
+ */
+static void StripScalabilityVariants(TArray<FLocalLightingScalabilityVariant>& Variants, const ITargetPlatform* TargetPlatform)
+{
+	int32 MinQualityLevel = 0;
+	int32 MaxQualityLevel = 4;
+	if (FConfigCacheIni* PlatformConfig = TargetPlatform->GetConfigSystem())
+	{
+		PlatformConfig->GetInt(TEXT("LocalLightingVolume"), TEXT("CookedMinQualityLevel"), MinQualityLevel, GEngineIni);
+		PlatformConfig->GetInt(TEXT("LocalLightingVolume"), TEXT("CookedMaxQualityLevel"), MaxQualityLevel, GEngineIni);
+	}
+
+	TBitArray<> SelectedVariants(false, Variants.Num());
+	for (int32 QualityLevel = MinQualityLevel; QualityLevel <= MaxQualityLevel; QualityLevel++)
+	{
+		const int32 VariantIndex = FindScalabilityVariant(Variants, QualityLevel);
+		if (VariantIndex != INDEX_NONE)
+		{
+			SelectedVariants[VariantIndex] = true;
+		}
+	}
+	for (int32 Index = Variants.Num() - 1; Index >= 0; Index--)
+	{
+		if (!SelectedVariants[Index])
+		{
+			Variants.RemoveAt(Index);
+		}
+	}
+}
+#endif
 
 UInterface_LocalLightingVolume::UInterface_LocalLightingVolume( const FObjectInitializer& ObjectInitializer )
 	: Super(ObjectInitializer)
@@ -24,38 +134,180 @@ ALocalLightingVolumeBase::ALocalLightingVolumeBase()
 {
 	bViewPointInVolume = false;
 	bOverridingLighting = false;
+	RestoringBaselineNames = nullptr;
+
+	Shape = ELocalLightingVolumeShape::Brush;
+	BoxExtent = FVector(100.0f);
+	SphereRadius = 100.0f;
+	CapsuleRadius = 50.0f;
+	CapsuleHalfHeight = 100.0f;
+
+	TransitionDuration = 0.0f;
+	BlendDistance = 0.0f;
+	bOverride_ViewIndirectLightingIntensity = false;
+	bOverride_ViewIndirectLightingColor = false;
+	ViewIndirectLightingIntensity = 1.0f;
+	ViewIndirectLightingColor = FLinearColor::White;
+
+	BlendWeight = 1.0f;
+	EnterOrder = 0;
+#if WITH_EDITORONLY_DATA
+	LastInteractiveEditTime = -DBL_MAX;
+#endif
+
+	ScalabilityGroup = ELocalLightingScalabilityGroup::Shadow;
+	ScalabilityVariantIndex = INDEX_NONE;
+
+	InstancesComponent = nullptr;
+
+	StatsShape = ELocalLightingVolumeShape::Brush;
+	RegisterComponentsStartCycles = 0;
+	bRegisteredIntoSubsystem = false;
+}
+
+void ALocalLightingVolumeBase::PreRegisterAllComponents()
+{
+	Super::PreRegisterAllComponents();
+
+	// Only the Brush shape needs the physics state to test containment, analytic shapes skip the physics body entirely.
+	GetBrushComponent()->bAlwaysCreatePhysicsState = Shape == ELocalLightingVolumeShape::Brush;
+
+#if STATS
+	RegisterComponentsStartCycles = FPlatformTime::Cycles();
+#endif
 }
 
 void ALocalLightingVolumeBase::PostRegisterAllComponents()
 {
 	Super::PostRegisterAllComponents();
 
-#if WITH_EDITOR
-	PreSaveHandle = UPackage::PreSavePackageWithContextEvent.AddUObject(this, &ALocalLightingVolumeBase::OnOverridingLightComponentPackagePreSave);
-	SavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &ALocalLightingVolumeBase::OnOverridingLightComponentPackageSaved);
+#if STATS
+	const float RegisterComponentsMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - RegisterComponentsStartCycles);
+	if (Shape == ELocalLightingVolumeShape::Brush)
+	{
+		INC_FLOAT_STAT_BY(STAT_LocalLightingVolume_RegisterBrushMs, RegisterComponentsMs);
+	}
+	else
+	{
+		INC_FLOAT_STAT_BY(STAT_LocalLightingVolume_RegisterAnalyticMs, RegisterComponentsMs);
+	}
 #endif
-	RegisterIntoSubsystem();
+
+	InstancesComponent = FindComponentByClass<ULocalLightingVolumeInstancesComponent>();
+	if (InstancesComponent)
+	{
+		InstancesComponent->SetShapeExtent(GetLocalShapeExtent());
+	}
+
+	UpdateScalabilityVariant();
+
+	// A linked Volume is driven by its parent instead of being evaluated on its own.
+	if (!LinkedParent.IsValid())
+	{
+		RegisterIntoSubsystem();
+	}
+	LinkVolumes();
 }
 
 void ALocalLightingVolumeBase::PostUnregisterAllComponents()
 {
 	Super::PostUnregisterAllComponents();
 
+	UnlinkVolumes();
+	if (LinkedParent.IsValid())
+	{
+		SetLinkedState(false, 1.0f);
+	}
+	if (bRegisteredIntoSubsystem)
+	{
+		UnregisterFromSubsystem();
+	}
+}
+
+void ALocalLightingVolumeBase::Serialize(FArchive& Ar)
+{
 #if WITH_EDITOR
-	UPackage::PreSavePackageWithContextEvent.Remove(PreSaveHandle);
-	UPackage::PackageSavedWithContextEvent.Remove(SavedHandle);
+	if (Ar.IsSaving() && Ar.IsCooking() && Ar.CookingTarget() && ScalabilityVariants.Num() > 0)
+	{
+		TArray<FLocalLightingScalabilityVariant> AllScalabilityVariants = ScalabilityVariants;
+		StripScalabilityVariants(ScalabilityVariants, Ar.CookingTarget());
+		Super::Serialize(Ar);
+		ScalabilityVariants = MoveTemp(AllScalabilityVariants);
+		return;
+	}
 #endif
-	UnregisterFromSubsystem();
+
+	Super::Serialize(Ar);
+}
+
+void ALocalLightingVolumeBase::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ScalabilityVariants.GetAllocatedSize() + ScalabilityAuthoredValues.GetAllocatedSize());
+
+	// The Brush model and its physics body are only created for this Volume, count them with it.
+	// Components such as the instances are already counted by AActor.
+	if (Brush)
+	{
+		Brush->GetResourceSizeEx(CumulativeResourceSize);
+	}
+	if (GetBrushComponent() && GetBrushComponent()->BrushBodySetup)
+	{
+		GetBrushComponent()->BrushBodySetup->GetResourceSizeEx(CumulativeResourceSize);
+	}
+}
+
+#if WITH_EDITOR
+void ALocalLightingVolumeBase::PreEditChange(FProperty* PropertyAboutToChange)
+{
+	Super::PreEditChange(PropertyAboutToChange);
+
+	if (PropertyAboutToChange && PropertyAboutToChange->GetFName() == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, LinkedVolumes))
+	{
+		UnlinkVolumes();
+	}
 }
 
+void ALocalLightingVolumeBase::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, LinkedVolumes) && GetRootComponent() && GetRootComponent()->IsRegistered())
+	{
+		LinkVolumes();
+	}
+	if (InstancesComponent &&
+		(MemberPropertyName == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, Shape) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, BoxExtent) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, SphereRadius) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, CapsuleRadius) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(ALocalLightingVolumeBase, CapsuleHalfHeight)))
+	{
+		InstancesComponent->SetShapeExtent(GetLocalShapeExtent());
+	}
+}
+#endif
+
 void ALocalLightingVolumeBase::Process(const FVector& ViewPoint)
 {
+#if ENABLE_DRAW_DEBUG
+	if (FLocalLightingVolumeDebugCounters::IsEnabled())
+	{
+		DebugCounters.Add(ELocalLightingDebugEvent::Test);
+	}
+#endif
+
 	bool bViewPointInVolumeLastTime = bViewPointInVolume;
-	bViewPointInVolume = EncompassesPoint(ViewPoint);
+	bViewPointInVolume = EncompassesViewPoint(ViewPoint);
 	if (bViewPointInVolumeLastTime != bViewPointInVolume)
 	{
+		RecordDebugTransition();
 		if (bViewPointInVolume)
 		{
+			EnterOrder = GNextVolumeEnterOrder++;
+			BlendWeight = GetBlendWeight(ViewPoint);
 			OverrideLighting();
 		}
 		else
@@ -63,35 +315,639 @@ void ALocalLightingVolumeBase::Process(const FVector& ViewPoint)
 			RestoreLighting();
 		}
 	}
+	else if (bViewPointInVolume && bOverridingLighting && BlendDistance > 0.0f)
+	{
+		// Skip weight changes too small to be noticed, but always land exactly on the full overrides.
+		const float NewBlendWeight = GetBlendWeight(ViewPoint);
+		if (NewBlendWeight != BlendWeight && (FMath::Abs(NewBlendWeight - BlendWeight) >= 0.01f || NewBlendWeight == 1.0f))
+		{
+			BlendWeight = NewBlendWeight;
+			UpdateBlendWeight();
+		}
+	}
+
+	UpdateLinkedVolumes();
+}
+
+bool ALocalLightingVolumeBase::EncompassesViewPoint(const FVector& ViewPoint) const
+{
+	if (Shape == ELocalLightingVolumeShape::Brush)
+	{
+		return EncompassesPoint(ViewPoint);
+	}
+
+	if (InstancesComponent && InstancesComponent->GetInstanceCount() > 0)
+	{
+		return InstancesComponent->GetShapeInstances().Encompasses(GetAnalyticShape(), ViewPoint);
+	}
+
+	return GetLocalDepth(GetActorTransform().InverseTransformPosition(ViewPoint)) >= 0.0f;
+}
+
+float ALocalLightingVolumeBase::GetBlendWeight(const FVector& ViewPoint) const
+{
+	if (BlendDistance <= 0.0f || Shape == ELocalLightingVolumeShape::Brush)
+	{
+		return 1.0f;
+	}
+
+	const float Depth = InstancesComponent && InstancesComponent->GetInstanceCount() > 0 ?
+		InstancesComponent->GetShapeInstances().GetMaxDepth(GetAnalyticShape(), ViewPoint) :
+		GetLocalDepth(GetActorTransform().InverseTransformPosition(ViewPoint));
+	return FLocalLightingShape::GetBlendWeight(Depth, BlendDistance);
+}
+
+float ALocalLightingVolumeBase::GetLocalDepth(const FVector& LocalViewPoint) const
+{
+	return Shape != ELocalLightingVolumeShape::Brush ? GetAnalyticShape().GetLocalDepth(LocalViewPoint) : -1.0f;
+}
+
+FVector ALocalLightingVolumeBase::GetLocalShapeExtent() const
+{
+	return Shape != ELocalLightingVolumeShape::Brush ? GetAnalyticShape().GetLocalExtent() : FVector::ZeroVector;
+}
+
+FLocalLightingShape ALocalLightingVolumeBase::GetAnalyticShape() const
+{
+	FLocalLightingShape AnalyticShape;
+	switch (Shape)
+	{
+	case ELocalLightingVolumeShape::Sphere:
+		AnalyticShape.Type = ELocalLightingShapeType::Sphere;
+		break;
+	case ELocalLightingVolumeShape::Capsule:
+		AnalyticShape.Type = ELocalLightingShapeType::Capsule;
+		break;
+	default:
+		AnalyticShape.Type = ELocalLightingShapeType::Box;
+		break;
+	}
+	AnalyticShape.BoxExtent = BoxExtent;
+	AnalyticShape.SphereRadius = SphereRadius;
+	AnalyticShape.CapsuleRadius = CapsuleRadius;
+	AnalyticShape.CapsuleHalfHeight = CapsuleHalfHeight;
+	return AnalyticShape;
+}
+
+float ALocalLightingVolumeBase::ApplyBlendWeight(float CacheValue, float Value) const
+{
+	return BlendWeight >= 1.0f ? Value : FMath::Lerp(CacheValue, Value, BlendWeight);
+}
+
+FLinearColor ALocalLightingVolumeBase::ApplyBlendWeight(const FLinearColor& CacheValue, const FLinearColor& Value) const
+{
+	return BlendWeight >= 1.0f ? Value : FMath::Lerp(CacheValue, Value, BlendWeight);
+}
+
+FRotator ALocalLightingVolumeBase::ApplyBlendWeight(const FRotator& CacheValue, const FRotator& Value) const
+{
+	return BlendWeight >= 1.0f ? Value : FQuat::Slerp(CacheValue.Quaternion(), Value.Quaternion(), BlendWeight).Rotator();
+}
+
+#if WITH_EDITOR
+bool ALocalLightingVolumeBase::ShouldApplyInteractiveEdit(const FPropertyChangedEvent& PropertyChangedEvent)
+{
+	if (PropertyChangedEvent.ChangeType != EPropertyChangeType::Interactive)
+	{
+		// The next drag applies its first change right away.
+		LastInteractiveEditTime = -DBL_MAX;
+		return true;
+	}
+
+	const float InteractiveEditRate = CVarLocalLightingVolumeEditorInteractiveEditRate.GetValueOnGameThread();
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (InteractiveEditRate > 0.0f && CurrentTime - LastInteractiveEditTime < 1.0 / InteractiveEditRate)
+	{
+		return false;
+	}
+	LastInteractiveEditTime = CurrentTime;
+	return true;
+}
+#endif
+
+void ALocalLightingVolumeBase::BlendLightProperty(ULightComponentBase* Component, ELocalLightingBlendProperty Property, float Value) const
+{
+	BlendLightValue(Component, Property, FVector4(Value, 0.0f, 0.0f, 0.0f));
+}
+
+void ALocalLightingVolumeBase::BlendLightProperty(ULightComponentBase* Component, const FLinearColor& LightColor) const
+{
+	BlendLightValue(Component, ELocalLightingBlendProperty::LightColor, FVector4(LightColor));
+}
+
+void ALocalLightingVolumeBase::BlendLightProperty(ULightComponentBase* Component, const FRotator& Rotation) const
+{
+	const FQuat Quat = Rotation.Quaternion();
+	BlendLightValue(Component, ELocalLightingBlendProperty::Rotation, FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W));
+}
+
+void ALocalLightingVolumeBase::SettleLightTransitions(ULightComponentBase* Component) const
+{
+	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(const_cast<ALocalLightingVolumeBase*>(this)))
+	{
+		Subsystem->GetTransitions().Settle(Component);
+	}
+}
+
+float ALocalLightingVolumeBase::GetSettledLightProperty(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const
+{
+	return static_cast<float>(GetSettledLightValue(Component, Property).X);
+}
+
+FLinearColor ALocalLightingVolumeBase::GetSettledLightColor(const ULightComponentBase* Component) const
+{
+	const FVector4 Value = GetSettledLightValue(Component, ELocalLightingBlendProperty::LightColor);
+	return FLinearColor(Value.X, Value.Y, Value.Z, Value.W);
+}
+
+FRotator ALocalLightingVolumeBase::GetSettledLightRotation(const ULightComponentBase* Component) const
+{
+	const FVector4 Value = GetSettledLightValue(Component, ELocalLightingBlendProperty::Rotation);
+	return FQuat(Value.X, Value.Y, Value.Z, Value.W).Rotator();
+}
+
+void ALocalLightingVolumeBase::BlendLightValue(ULightComponentBase* Component, ELocalLightingBlendProperty Property, const FVector4& Value) const
+{
+	RecordDebugMutation();
+
+	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(const_cast<ALocalLightingVolumeBase*>(this)))
+	{
+		// A snapshot lands on its lighting in one frame, without blending.
+		Subsystem->GetTransitions().SetValue(Component, Property, Value, Subsystem->IsApplyingSnapshot() ? 0.0f : TransitionDuration);
+	}
+	else
+	{
+		FLocalLightingTransitions::WriteValue(Component, Property, Value);
+	}
+}
+
+FVector4 ALocalLightingVolumeBase::GetSettledLightValue(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const
+{
+	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(const_cast<ALocalLightingVolumeBase*>(this)))
+	{
+		return Subsystem->GetTransitions().GetSettledValue(Component, Property);
+	}
+	return FLocalLightingTransitions::ReadValue(Component, Property);
+}
+
+FBox ALocalLightingVolumeBase::GetShapeBounds() const
+{
+	if (Shape == ELocalLightingVolumeShape::Brush)
+	{
+		return GetBrushComponent() ? GetBrushComponent()->Bounds.GetBox() : FBox(ForceInit);
+	}
+	if (InstancesComponent && InstancesComponent->GetInstanceCount() > 0)
+	{
+		return InstancesComponent->GetInstancesBounds();
+	}
+	const FVector Extent = GetLocalShapeExtent();
+	return FBox(-Extent, Extent).TransformBy(GetActorTransform());
+}
+
+void ALocalLightingVolumeBase::GetOverridePayload(TMap<FName, FString>& OutPayload) const
+{
+	static const FString OverridePrefix(TEXT("bOverride_"));
+	for (TFieldIterator<FBoolProperty> It(GetClass()); It; ++It)
+	{
+		const FString PropertyName = It->GetName();
+		if (PropertyName.StartsWith(OverridePrefix) && It->GetPropertyValue_InContainer(this))
+		{
+			const FName ValueName(*PropertyName.RightChop(OverridePrefix.Len()));
+			if (const FProperty* ValueProperty = GetClass()->FindPropertyByName(ValueName))
+			{
+				FString Value;
+				ValueProperty->ExportTextItem_InContainer(Value, this, nullptr, nullptr, PPF_None);
+				OutPayload.Add(ValueName, MoveTemp(Value));
+			}
+		}
+	}
+}
+
+void ALocalLightingVolumeBase::GetCachePayload(TMap<FName, FString>& OutPayload) const
+{
+	TMap<FName, FString> Payload;
+	GetOverridePayload(Payload);
+	for (const TPair<FName, FString>& Pair : Payload)
+	{
+		if (const FProperty* CacheProperty = FindCacheProperty(GetClass(), Pair.Key))
+		{
+			FString Value;
+			CacheProperty->ExportTextItem_InContainer(Value, this, nullptr, nullptr, PPF_None);
+			OutPayload.Add(Pair.Key, MoveTemp(Value));
+		}
+	}
+}
+
+void ALocalLightingVolumeBase::RestoreBaseline(TMap<FName, FString>& InOutBaselineValues)
+{
+	if (bViewPointInVolume)
+	{
+		return;
+	}
+
+	// RestoreLighting writes the cached values back, so the baseline stands in for the cache for the time of the restore and
+	// the cache of the Volume is put back afterwards. Only the overrides holding a baseline value are written, the others and
+	// the authored toggles are left untouched.
+	TSet<FName> BaselineNames;
+	TArray<TPair<const FProperty*, FString>, TInlineAllocator<16>> CacheValues;
+	TMap<FName, FString> Payload;
+	GetOverridePayload(Payload);
+	for (const TPair<FName, FString>& Pair : Payload)
+	{
+		const FString* BaselineValue = InOutBaselineValues.Find(Pair.Key);
+		const FProperty* CacheProperty = BaselineValue ? FindCacheProperty(GetClass(), Pair.Key) : nullptr;
+		if (!CacheProperty)
+		{
+			continue;
+		}
+
+		FString CacheValue;
+		CacheProperty->ExportTextItem_InContainer(CacheValue, this, nullptr, nullptr, PPF_None);
+		if (CacheProperty->ImportText_InContainer(**BaselineValue, this, this, PPF_None))
+		{
+			CacheValues.Emplace(CacheProperty, MoveTemp(CacheValue));
+			BaselineNames.Add(Pair.Key);
+			InOutBaselineValues.Remove(Pair.Key);
+		}
+	}
+	if (BaselineNames.Num() > 0)
+	{
+		TGuardValue<const TSet<FName>*> RestoringBaselineGuard(RestoringBaselineNames, &BaselineNames);
+		RestoreLighting();
+	}
+	for (const TPair<const FProperty*, FString>& CacheValue : CacheValues)
+	{
+		CacheValue.Key->ImportText_InContainer(*CacheValue.Value, this, this, PPF_None);
+	}
+}
+
+bool ALocalLightingVolumeBase::ShouldRestoreOverride(FName OverrideName, bool bChanged) const
+{
+	return RestoringBaselineNames ? RestoringBaselineNames->Contains(OverrideName) : bChanged;
 }
 
+bool ALocalLightingVolumeBase::IsViewPointInVolume() const
+{
+	return bViewPointInVolume;
+}
+
+float ALocalLightingVolumeBase::GetAppliedBlendWeight() const
+{
+	return BlendWeight;
+}
+
+uint32 ALocalLightingVolumeBase::GetEnterOrder() const
+{
+	return EnterOrder;
+}
+
+void ALocalLightingVolumeBase::UpdateSubsystemBounds()
+{
+	if (bRegisteredIntoSubsystem)
+	{
+		if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(this))
+		{
+			Subsystem->UpdateVolumeBounds(this);
+		}
+	}
+}
+
+bool ALocalLightingVolumeBase::HasViewOverrides() const
+{
+	if (bOverride_ViewIndirectLightingIntensity || bOverride_ViewIndirectLightingColor)
+	{
+		return true;
+	}
+	for (const ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this
+			&& (LinkedVolume->bOverride_ViewIndirectLightingIntensity || LinkedVolume->bOverride_ViewIndirectLightingColor))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const TArray<TObjectPtr<ALocalLightingVolumeBase>>& ALocalLightingVolumeBase::GetLinkedVolumes() const
+{
+	return LinkedVolumes;
+}
+
+#if ENABLE_DRAW_DEBUG
+FLocalLightingVolumeDebugCounters& ALocalLightingVolumeBase::GetDebugCounters()
+{
+	return DebugCounters;
+}
+#endif
+
+bool ALocalLightingVolumeBase::CanMergeWith(const ALocalLightingVolumeBase* Other) const
+{
+	if (!Other || Other == this || Other->GetClass() != GetClass() || Other->GetOverrideTarget() != GetOverrideTarget())
+	{
+		return false;
+	}
+
+	// Shape and Transition settings must match, the instances of an analytic Shape share its extent.
+	for (TFieldIterator<FProperty> It(ALocalLightingVolumeBase::StaticClass(), EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		if (!It->HasAnyPropertyFlags(CPF_Transient) && !It->Identical_InContainer(this, Other))
+		{
+			return false;
+		}
+	}
+
+	FLocalLightingOverridePayload Payload;
+	FLocalLightingOverridePayload OtherPayload;
+	GetOverridePayload(Payload);
+	Other->GetOverridePayload(OtherPayload);
+	return FLocalLightingOverrideDiff::Compute(Payload, OtherPayload).IsEmpty();
+}
+
+#if WITH_EDITOR
+bool ALocalLightingVolumeBase::MergeVolume(ALocalLightingVolumeBase* Other)
+{
+	if (!CanMergeWith(Other))
+	{
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+	Modify();
+
+	if (Shape == ELocalLightingVolumeShape::Brush)
+	{
+		UBrushComponent* BrushComponent = GetBrushComponent();
+		UBodySetup* BodySetup = BrushComponent ? BrushComponent->BrushBodySetup.Get() : nullptr;
+		const UBodySetup* OtherBodySetup = Other->GetBrushComponent() ? Other->GetBrushComponent()->BrushBodySetup.Get() : nullptr;
+		if (!BodySetup || !OtherBodySetup || !Brush || !Brush->Polys || !Other->Brush || !Other->Brush->Polys)
+		{
+			return false;
+		}
+
+		// Containment is tested against the convex elements, bake the transform of Other into their vertices.
+		const FTransform OtherToThis = Other->GetActorTransform().GetRelativeTransform(GetActorTransform());
+		BodySetup->Modify();
+		for (const FKConvexElem& OtherElem : OtherBodySetup->AggGeom.ConvexElems)
+		{
+			const FTransform ElemToThis = OtherElem.GetTransform() * OtherToThis;
+			FKConvexElem& Elem = BodySetup->AggGeom.ConvexElems.Add_GetRef(OtherElem);
+			for (FVector& Vertex : Elem.VertexData)
+			{
+				Vertex = ElemToThis.TransformPosition(Vertex);
+			}
+			Elem.SetTransform(FTransform::Identity);
+			Elem.UpdateElemBox();
+		}
+		BodySetup->InvalidatePhysicsData();
+		BodySetup->CreatePhysicsMeshes();
+
+		// The polygons only draw the outline and bound the Brush.
+		Brush->Modify();
+		Brush->Polys->Modify();
+		for (FPoly Poly : Other->Brush->Polys->Element)
+		{
+			for (FVector3f& Vertex : Poly.Vertices)
+			{
+				Vertex = FVector3f(OtherToThis.TransformPosition(FVector(Vertex)));
+			}
+			Poly.Base = FVector3f(OtherToThis.TransformPosition(FVector(Poly.Base)));
+			Poly.TextureU = FVector3f(OtherToThis.TransformVector(FVector(Poly.TextureU)));
+			Poly.TextureV = FVector3f(OtherToThis.TransformVector(FVector(Poly.TextureV)));
+			Poly.Actor = this;
+			Poly.CalcNormal();
+			Brush->Polys->Element.Add(Poly);
+		}
+		Brush->BuildBound();
+
+		// The builder only knows the original shape, rebuilding from it would drop the merged elements.
+		BrushBuilder = nullptr;
+
+		BrushComponent->RecreatePhysicsState();
+		BrushComponent->UpdateBounds();
+		BrushComponent->MarkRenderStateDirty();
+		return true;
+	}
+
+	if (!InstancesComponent)
+	{
+		InstancesComponent = NewObject<ULocalLightingVolumeInstancesComponent>(this, NAME_None, RF_Transactional);
+		InstancesComponent->SetupAttachment(GetRootComponent());
+		AddInstanceComponent(InstancesComponent);
+		InstancesComponent->RegisterComponent();
+		InstancesComponent->SetShapeExtent(GetLocalShapeExtent());
+	}
+	InstancesComponent->Modify();
+
+	TArray<FTransform> Transforms;
+	if (InstancesComponent->GetInstanceCount() == 0)
+	{
+		// Instances replace the single Shape, keep it as the first one.
+		Transforms.Add(FTransform::Identity);
+	}
+	const FTransform& ComponentTransform = InstancesComponent->GetComponentTransform();
+	if (Other->InstancesComponent && Other->InstancesComponent->GetInstanceCount() > 0)
+	{
+		const FTransform& OtherComponentTransform = Other->InstancesComponent->GetComponentTransform();
+		for (const FTransform& OtherInstanceTransform : Other->InstancesComponent->GetInstanceTransforms())
+		{
+			Transforms.Add((OtherInstanceTransform * OtherComponentTransform).GetRelativeTransform(ComponentTransform));
+		}
+	}
+	else
+	{
+		Transforms.Add(Other->GetActorTransform().GetRelativeTransform(ComponentTransform));
+	}
+	InstancesComponent->AddInstances(Transforms);
+	return true;
+}
+#endif
+
 bool ALocalLightingVolumeBase::IsOverridingLighting() const
 {
 	return bOverridingLighting;
 }
 
+FLocalLightingVolumeHandle ALocalLightingVolumeBase::GetSubsystemHandle() const
+{
+	return SubsystemHandle;
+}
+
+void ALocalLightingVolumeBase::SetSubsystemHandle(const FLocalLightingVolumeHandle& Handle)
+{
+	SubsystemHandle = Handle;
+}
+
+void ALocalLightingVolumeBase::ForceEnter()
+{
+	ForceEnterWithBlendWeight(1.0f);
+}
+
+void ALocalLightingVolumeBase::ForceEnterWithBlendWeight(float InBlendWeight)
+{
+	if (!bViewPointInVolume)
+	{
+		RecordDebugTransition();
+		bViewPointInVolume = true;
+		EnterOrder = GNextVolumeEnterOrder++;
+		BlendWeight = InBlendWeight;
+		OverrideLighting();
+	}
+	UpdateLinkedVolumes();
+}
+
+void ALocalLightingVolumeBase::ForceExit()
+{
+	if (bViewPointInVolume)
+	{
+		RecordDebugTransition();
+		RestoreLighting();
+		bViewPointInVolume = false;
+	}
+	UpdateLinkedVolumes();
+}
+
+void ALocalLightingVolumeBase::ResolveViewOverrides(const FVector& ViewPoint, FLocalLightingViewOverrides& InOutOverrides) const
+{
+#if ENABLE_DRAW_DEBUG
+	if (FLocalLightingVolumeDebugCounters::IsEnabled())
+	{
+		const_cast<ALocalLightingVolumeBase*>(this)->DebugCounters.Add(ELocalLightingDebugEvent::Test);
+	}
+#endif
+
+	if (!EncompassesViewPoint(ViewPoint))
+	{
+		return;
+	}
+
+	// Linked Volumes follow the weight of their parent, as they do on the light components.
+	const float ViewBlendWeight = GetBlendWeight(ViewPoint);
+	ApplyViewOverrides(ViewBlendWeight, InOutOverrides);
+	for (const ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this)
+		{
+			LinkedVolume->ApplyViewOverrides(ViewBlendWeight, InOutOverrides);
+		}
+	}
+}
+
+void ALocalLightingVolumeBase::ApplyViewOverrides(float ViewBlendWeight, FLocalLightingViewOverrides& InOutOverrides) const
+{
+	if (bOverride_ViewIndirectLightingIntensity)
+	{
+		InOutOverrides.BlendIndirectLightingIntensity(ViewIndirectLightingIntensity, ViewBlendWeight);
+	}
+	if (bOverride_ViewIndirectLightingColor)
+	{
+		InOutOverrides.BlendIndirectLightingColor(ViewIndirectLightingColor, ViewBlendWeight);
+	}
+}
+
+void ALocalLightingVolumeBase::UpdateScalabilityVariant()
+{
+	for (ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this)
+		{
+			LinkedVolume->UpdateScalabilityVariant();
+		}
+	}
+
+	// Variants replace the authored overrides, which must never be saved, so they only apply in game Worlds.
+	const UWorld* World = GetWorld();
+	if (ScalabilityVariants.Num() == 0 || !World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	const int32 VariantIndex = FindScalabilityVariant(ScalabilityVariants, GetScalabilityQualityLevel(ScalabilityGroup));
+	if (VariantIndex == ScalabilityVariantIndex)
+	{
+		return;
+	}
+
+	// Restore the light components first, so that the new overrides cache them unmodified.
+	if (IsOverridingLighting())
+	{
+		RestoreLighting();
+	}
+
+	for (const TPair<FName, FString>& Pair : ScalabilityAuthoredValues)
+	{
+		if (const FProperty* Property = GetClass()->FindPropertyByName(Pair.Key))
+		{
+			Property->ImportText_InContainer(*Pair.Value, this, this, PPF_None);
+		}
+	}
+	ScalabilityAuthoredValues.Reset();
+
+	ScalabilityVariantIndex = VariantIndex;
+	if (ScalabilityVariants.IsValidIndex(VariantIndex))
+	{
+		for (const TPair<FName, FString>& Pair : ScalabilityVariants[VariantIndex].Overrides)
+		{
+			ImportScalabilityValue(FName(*(TEXT("bOverride_") + Pair.Key.ToString())), Pair.Value.IsEmpty() ? TEXT("False") : TEXT("True"));
+			if (!Pair.Value.IsEmpty())
+			{
+				ImportScalabilityValue(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	if (bViewPointInVolume)
+	{
+		OverrideLighting();
+	}
+}
+
+void ALocalLightingVolumeBase::ImportScalabilityValue(FName PropertyName, const FString& Value)
+{
+	const FProperty* Property = GetClass()->FindPropertyByName(PropertyName);
+	if (!Property)
+	{
+		UE_LOG(LogLocalLightingVolume, Warning, TEXT("%s: scalability variant overrides the unknown property %s."), *GetActorNameOrLabel(), *PropertyName.ToString());
+		return;
+	}
+
+	if (!ScalabilityAuthoredValues.Contains(PropertyName))
+	{
+		FString AuthoredValue;
+		Property->ExportTextItem_InContainer(AuthoredValue, this, nullptr, nullptr, PPF_None);
+		ScalabilityAuthoredValues.Add(PropertyName, MoveTemp(AuthoredValue));
+	}
+	Property->ImportText_InContainer(*Value, this, this, PPF_None);
+}
+
 #if WITH_EDITOR
-void ALocalLightingVolumeBase::OnOverridingLightComponentPackagePreSave(UPackage* Package, FObjectPreSaveContext Context)
+void ALocalLightingVolumeBase::OnOwningPackagePreSave()
 {
-	// We can assert that this Volume and other light components are all in the same UWorld package.
-	if (Package == GetOutermost())
+	if (IsOverridingLighting())
 	{
-		if (IsOverridingLighting())
+		// We can not be overriding any light component when they are saved.
+		RestoreLighting();
+	}
+	for (ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this)
 		{
-			// We can not be overriding any light component when they are saved.
-			RestoreLighting();
+			LinkedVolume->OnOwningPackagePreSave();
 		}
 	}
 }
 
-void ALocalLightingVolumeBase::OnOverridingLightComponentPackageSaved(const FString& FileName, UPackage* Package, FObjectPostSaveContext Context)
+void ALocalLightingVolumeBase::OnOwningPackageSaved()
 {
-	// We can assert that this Volume and other light components are all in the same UWorld package.
-	if (Package == GetOutermost())
+	if (bViewPointInVolume)
 	{
-		if (bViewPointInVolume)
+		OverrideLighting();
+	}
+	for (ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this)
 		{
-			OverrideLighting();
+			LinkedVolume->OnOwningPackageSaved();
 		}
 	}
 }
@@ -99,16 +955,154 @@ void ALocalLightingVolumeBase::OnOverridingLightComponentPackageSaved(const FStr
 
 void ALocalLightingVolumeBase::RegisterIntoSubsystem()
 {
+	bRegisteredIntoSubsystem = true;
 	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(this))
 	{
 		Subsystem->RegisterVolume(this);
 	}
+	if (RootComponent)
+	{
+		RootTransformUpdatedHandle = RootComponent->TransformUpdated.AddUObject(this, &ALocalLightingVolumeBase::OnRootTransformUpdated);
+	}
+
+#if STATS
+	StatsShape = Shape;
+	if (StatsShape == ELocalLightingVolumeShape::Brush)
+	{
+		INC_DWORD_STAT(STAT_LocalLightingVolume_NumBrushVolumes);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_LocalLightingVolume_NumAnalyticVolumes);
+	}
+#endif
 }
 
 void ALocalLightingVolumeBase::UnregisterFromSubsystem()
 {
+	bRegisteredIntoSubsystem = false;
 	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(this))
 	{
 		Subsystem->UnregisterVolume(this);
 	}
+	if (RootComponent)
+	{
+		RootComponent->TransformUpdated.Remove(RootTransformUpdatedHandle);
+	}
+	RootTransformUpdatedHandle.Reset();
+
+#if STATS
+	if (StatsShape == ELocalLightingVolumeShape::Brush)
+	{
+		DEC_DWORD_STAT(STAT_LocalLightingVolume_NumBrushVolumes);
+	}
+	else
+	{
+		DEC_DWORD_STAT(STAT_LocalLightingVolume_NumAnalyticVolumes);
+	}
+#endif
+}
+
+void ALocalLightingVolumeBase::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	UpdateSubsystemBounds();
+}
+
+void ALocalLightingVolumeBase::LinkVolumes()
+{
+	for (ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (!IsValid(LinkedVolume) || LinkedVolume->LinkedParent.Get() == this)
+		{
+			continue;
+		}
+		if (LinkedVolume == this || LinkedVolume->LinkedParent.IsValid() || LinkedVolume->LinkedVolumes.Num() > 0 || LinkedParent.IsValid())
+		{
+			UE_LOG(LogLocalLightingVolume, Warning, TEXT("%s: can not link %s, a Volume is linked by one Volume at most and can not both link and be linked."), *GetActorNameOrLabel(), *LinkedVolume->GetActorNameOrLabel());
+			continue;
+		}
+
+		LinkedVolume->ForceExit();
+		if (LinkedVolume->bRegisteredIntoSubsystem)
+		{
+			LinkedVolume->UnregisterFromSubsystem();
+		}
+		LinkedVolume->LinkedParent = this;
+		LinkedVolume->SetLinkedState(bViewPointInVolume, BlendWeight);
+	}
+}
+
+void ALocalLightingVolumeBase::UnlinkVolumes()
+{
+	for (ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this)
+		{
+			LinkedVolume->SetLinkedState(false, 1.0f);
+			LinkedVolume->LinkedParent.Reset();
+			// Evaluated on its own again as long as its components stay registered.
+			if (LinkedVolume->GetRootComponent() && LinkedVolume->GetRootComponent()->IsRegistered())
+			{
+				LinkedVolume->RegisterIntoSubsystem();
+			}
+		}
+	}
+}
+
+void ALocalLightingVolumeBase::SetLinkedState(bool bInVolume, float InBlendWeight)
+{
+	if (bInVolume != bViewPointInVolume)
+	{
+		RecordDebugTransition();
+		if (bInVolume)
+		{
+			bViewPointInVolume = true;
+			EnterOrder = GNextVolumeEnterOrder++;
+			BlendWeight = InBlendWeight;
+			OverrideLighting();
+		}
+		else
+		{
+			RestoreLighting();
+			bViewPointInVolume = false;
+		}
+	}
+	else if (bInVolume && bOverridingLighting && InBlendWeight != BlendWeight)
+	{
+		BlendWeight = InBlendWeight;
+		UpdateBlendWeight();
+	}
+}
+
+void ALocalLightingVolumeBase::UpdateLinkedVolumes()
+{
+	for (ALocalLightingVolumeBase* LinkedVolume : LinkedVolumes)
+	{
+		if (IsValid(LinkedVolume) && LinkedVolume->LinkedParent.Get() == this)
+		{
+			LinkedVolume->SetLinkedState(bViewPointInVolume, BlendWeight);
+		}
+	}
+}
+
+void ALocalLightingVolumeBase::RecordDebugTransition()
+{
+#if ENABLE_DRAW_DEBUG
+	if (!FLocalLightingVolumeDebugCounters::IsEnabled())
+	{
+		return;
+	}
+
+	DebugCounters.Add(ELocalLightingDebugEvent::Transition);
+#endif
+}
+
+void ALocalLightingVolumeBase::RecordDebugMutation() const
+{
+#if ENABLE_DRAW_DEBUG
+	if (FLocalLightingVolumeDebugCounters::IsEnabled())
+	{
+		const_cast<ALocalLightingVolumeBase*>(this)->DebugCounters.Add(ELocalLightingDebugEvent::Mutation);
+	}
+#endif
 }
@@ -0,0 +1,126 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalConsoleVariableOverrides.h"
+
+// Engine Include
+#include "HAL/IConsoleManager.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+#include "LocalLightingVolume.h"
+
+/** Count a write of the Console Variable in the debug counters of the Volume owning the override. */
+static void RecordDebugMutation(const UObject* Owner)
+{
+	if (const ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(Owner))
+	{
+		Volume->RecordDebugMutation();
+	}
+}
+
+FLocalConsoleVariableOverrides& FLocalConsoleVariableOverrides::Get()
+{
+	static FLocalConsoleVariableOverrides Instance;
+	return Instance;
+}
+
+bool FLocalConsoleVariableOverrides::Push(const UObject* Owner, const FString& Name, const FString& Value)
+{
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+	FOverrideStack* Stack = Stacks.Find(Name);
+	if (!Stack)
+	{
+		IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(*Name);
+		if (!Variable)
+		{
+			UE_LOG(LogLocalLightingVolume, Warning, TEXT("Console Variable %s overridden by %s does not exist."), *Name, *GetNameSafe(Owner));
+			return false;
+		}
+		const EConsoleVariableFlags SetBy = (EConsoleVariableFlags)(Variable->GetFlags() & ECVF_SetByMask);
+		if (SetBy >= ECVF_SetByCommandline)
+		{
+			// Respect values set from the command line, from code or from the console.
+			UE_LOG(LogLocalLightingVolume, Verbose, TEXT("Console Variable %s has been set from the command line, code or the console, skipping override of %s."), *Name, *GetNameSafe(Owner));
+			return false;
+		}
+
+		Stack = &Stacks.Add(Name);
+		Stack->Variable = Variable;
+		Stack->SetBy = SetBy;
+		Stack->bBaselineIsFloat = Variable->IsVariableFloat();
+		Stack->BaselineFloatValue = Stack->bBaselineIsFloat ? Variable->GetFloat() : 0.0f;
+		Stack->BaselineValue = Variable->GetString();
+	}
+
+	Stack->Variable->Set(*Stack->Overrides.Push(FObjectKey(Owner), Value), Stack->SetBy);
+	RecordDebugMutation(Owner);
+	return true;
+}
+
+void FLocalConsoleVariableOverrides::Pop(const UObject* Owner, const FString& Name)
+{
+	if (FOverrideStack* Stack = Stacks.Find(Name))
+	{
+		if (RemoveOverride(*Stack, Owner))
+		{
+			Stacks.Remove(Name);
+		}
+	}
+}
+
+void FLocalConsoleVariableOverrides::PopAll(const UObject* Owner)
+{
+	for (auto It = Stacks.CreateIterator(); It; ++It)
+	{
+		if (RemoveOverride(It.Value(), Owner))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FLocalConsoleVariableOverrides::RemoveOverride(FOverrideStack& Stack, const UObject* Owner)
+{
+	switch (Stack.Overrides.Remove(FObjectKey(Owner)))
+	{
+	case ELocalLightingOverrideStackChange::Baseline:
+		if (Stack.bBaselineIsFloat)
+		{
+			Stack.Variable->Set(Stack.BaselineFloatValue, Stack.SetBy);
+		}
+		else
+		{
+			Stack.Variable->Set(*Stack.BaselineValue, Stack.SetBy);
+		}
+		RecordDebugMutation(Owner);
+		return true;
+	case ELocalLightingOverrideStackChange::Top:
+		// Only the top of the stack is visible, lower overrides leave the current value untouched.
+		Stack.Variable->Set(*Stack.Overrides.Top(), Stack.SetBy);
+		RecordDebugMutation(Owner);
+		return false;
+	default:
+		return false;
+	}
+}
+
+SIZE_T FLocalConsoleVariableOverrides::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = Stacks.GetAllocatedSize();
+	for (const TPair<FString, FOverrideStack>& Pair : Stacks)
+	{
+		AllocatedSize += Pair.Key.GetAllocatedSize() + Pair.Value.BaselineValue.GetAllocatedSize() + Pair.Value.Overrides.GetAllocatedSize();
+		Pair.Value.Overrides.ForEachValue([&AllocatedSize](const FString& Value)
+		{
+			AllocatedSize += Value.GetAllocatedSize();
+		});
+	}
+	return AllocatedSize;
+}
@@ -0,0 +1,95 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalConsoleVariableVolume.h"
+
+// Engine Include
+#include "Components/BrushComponent.h"
+
+// Plugins Include
+#include "LocalConsoleVariableOverrides.h"
+
+ALocalConsoleVariableVolume::ALocalConsoleVariableVolume()
+{
+	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+	GetBrushComponent()->Mobility = EComponentMobility::Movable;
+}
+
+void ALocalConsoleVariableVolume::PostUnregisterAllComponents()
+{
+	// Console Variables outlive the Volume, so never leave them overridden once it is gone.
+	if (bViewPointInVolume)
+	{
+		RestoreLighting();
+		bViewPointInVolume = false;
+	}
+
+	Super::PostUnregisterAllComponents();
+}
+
+void ALocalConsoleVariableVolume::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	SIZE_T ConsoleVariablesSize = ConsoleVariables.GetAllocatedSize();
+	for (const FLocalConsoleVariableOverride& ConsoleVariable : ConsoleVariables)
+	{
+		ConsoleVariablesSize += ConsoleVariable.Name.GetAllocatedSize() + ConsoleVariable.Value.GetAllocatedSize();
+	}
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(ConsoleVariablesSize);
+}
+
+void ALocalConsoleVariableVolume::GetOverridePayload(TMap<FName, FString>& OutPayload) const
+{
+	for (const FLocalConsoleVariableOverride& ConsoleVariable : ConsoleVariables)
+	{
+		if (!ConsoleVariable.Name.IsEmpty())
+		{
+			OutPayload.Add(FName(*ConsoleVariable.Name), ConsoleVariable.Value);
+		}
+	}
+}
+
+void ALocalConsoleVariableVolume::OverrideLighting()
+{
+	bOverridingLighting = false;
+	for (const FLocalConsoleVariableOverride& ConsoleVariable : ConsoleVariables)
+	{
+		if (!ConsoleVariable.Name.IsEmpty())
+		{
+			bOverridingLighting |= FLocalConsoleVariableOverrides::Get().Push(this, ConsoleVariable.Name, ConsoleVariable.Value);
+		}
+	}
+}
+
+void ALocalConsoleVariableVolume::RestoreLighting()
+{
+	FLocalConsoleVariableOverrides::Get().PopAll(this);
+	bOverridingLighting = false;
+}
+
+#if WITH_EDITOR
+void ALocalConsoleVariableVolume::PreEditChange(FProperty* PropertyAboutToChange)
+{
+	if (bViewPointInVolume)
+	{
+		RestoreLighting();
+	}
+	Super::PreEditChange(PropertyAboutToChange);
+}
+
+void ALocalConsoleVariableVolume::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (bViewPointInVolume)
+	{
+		OverrideLighting();
+	}
+}
+#endif
@@ -10,16 +10,21 @@
 
 // Engine Include
 #include "Components/BrushComponent.h"
+#include "Components/DirectionalLightComponent.h"
 #include "Components/LightComponent.h"
 #include "Engine/DirectionalLight.h"
 
 // Plugins Include
 #include "LocalLightingSubsystem.h"
 
+static UDirectionalLightComponent* GetDirectionalLightComponent(ADirectionalLight* DirectionalLight)
+{
+	return CastChecked<UDirectionalLightComponent>(DirectionalLight->GetLightComponent());
+}
+
 ALocalDirectionalLightVolume::ALocalDirectionalLightVolume()
 {
 	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
-	GetBrushComponent()->bAlwaysCreatePhysicsState = true;
 	GetBrushComponent()->Mobility = EComponentMobility::Movable;
 
 	bOverride_Rotation = false;
@@ -27,6 +32,13 @@ ALocalDirectionalLightVolume::ALocalDirectionalLightVolume()
 	bOverride_LightColor = false;
 	bOverride_IndirectLightingIntensity = false;
 	bOverride_VolumetricScatteringIntensity = false;
+	bOverride_CastShadows = false;
+	bOverride_DynamicShadowDistanceMovableLight = false;
+	bOverride_DynamicShadowCascades = false;
+	bOverride_FarShadowCascadeCount = false;
+	bOverride_FarShadowDistance = false;
+	bOverride_ShadowResolutionScale = false;
+	bOverride_ContactShadowLength = false;
 
 	DirectionalLight = nullptr;
 	Rotation = FRotator(-46.0f, 0.0f, 0.0f);
@@ -34,12 +46,26 @@ ALocalDirectionalLightVolume::ALocalDirectionalLightVolume()
 	LightColor = FColor::White;
 	IndirectLightingIntensity = 1.0f;
 	VolumetricScatteringIntensity = 1.0f;
+	CastShadows = true;
+	DynamicShadowDistanceMovableLight = 20000.0f;
+	DynamicShadowCascades = 3;
+	FarShadowCascadeCount = 0;
+	FarShadowDistance = 300000.0f;
+	ShadowResolutionScale = 1.0f;
+	ContactShadowLength = 0.0f;
 
 	CacheRotation = FRotator(-46.0f, 0.0f, 0.0f);
 	CacheIntensity = 1.0f;
 	CacheLightColor = FColor::White;
 	CacheIndirectLightingIntensity = 1.0f;
 	CacheVolumetricScatteringIntensity = 1.0f;
+	bCacheCastShadows = true;
+	CacheDynamicShadowDistanceMovableLight = 20000.0f;
+	CacheDynamicShadowCascades = 3;
+	CacheFarShadowCascadeCount = 0;
+	CacheFarShadowDistance = 300000.0f;
+	CacheShadowResolutionScale = 1.0f;
+	CacheContactShadowLength = 0.0f;
 
 #if WITH_EDITORONLY_DATA
 	CacheDirectionalLight = nullptr;
@@ -48,9 +74,21 @@ ALocalDirectionalLightVolume::ALocalDirectionalLightVolume()
 	bCacheOverride_LightColor = false;
 	bCacheOverride_IndirectLightingIntensity = false;
 	bCacheOverride_VolumetricScatteringIntensity = false;
+	bCacheOverride_CastShadows = false;
+	bCacheOverride_DynamicShadowDistanceMovableLight = false;
+	bCacheOverride_DynamicShadowCascades = false;
+	bCacheOverride_FarShadowCascadeCount = false;
+	bCacheOverride_FarShadowDistance = false;
+	bCacheOverride_ShadowResolutionScale = false;
+	bCacheOverride_ContactShadowLength = false;
 #endif
 }
 
+AActor* ALocalDirectionalLightVolume::GetOverrideTarget() const
+{
+	return DirectionalLight.Get();
+}
+
 void ALocalDirectionalLightVolume::OverrideLighting()
 {
 	bOverridingLighting = false;
@@ -58,46 +96,118 @@ void ALocalDirectionalLightVolume::OverrideLighting()
 	{
 		if (bOverride_Rotation)
 		{
-			CacheRotation = DirectionalLight->GetLightComponent()->GetComponentTransform().Rotator();
+			CacheRotation = GetSettledLightRotation(DirectionalLight->GetLightComponent());
 			if (CacheRotation != Rotation)
 			{
-				DirectionalLight->GetLightComponent()->SetWorldRotation(Rotation);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ApplyBlendWeight(CacheRotation, Rotation));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_Intensity)
 		{
-			CacheIntensity = DirectionalLight->GetLightComponent()->Intensity;
+			CacheIntensity = GetSettledLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity);
 			if (CacheIntensity != Intensity)
 			{
-				DirectionalLight->GetLightComponent()->SetIntensity(Intensity);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity, ApplyBlendWeight(CacheIntensity, Intensity));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_LightColor)
 		{
-			CacheLightColor = DirectionalLight->GetLightComponent()->GetLightColor().ToFColor(true);
+			CacheLightColor = GetSettledLightColor(DirectionalLight->GetLightComponent()).ToFColor(true);
 			if (CacheLightColor != LightColor)
 			{
-				DirectionalLight->GetLightComponent()->SetLightColor(FLinearColor::FromSRGBColor(LightColor));
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ApplyBlendWeight(FLinearColor::FromSRGBColor(CacheLightColor), FLinearColor::FromSRGBColor(LightColor)));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_IndirectLightingIntensity)
 		{
-			CacheIndirectLightingIntensity = DirectionalLight->GetLightComponent()->IndirectLightingIntensity;
+			CacheIndirectLightingIntensity = GetSettledLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity);
 			if (CacheIndirectLightingIntensity != IndirectLightingIntensity)
 			{
-				DirectionalLight->GetLightComponent()->SetIndirectLightingIntensity(IndirectLightingIntensity);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity, ApplyBlendWeight(CacheIndirectLightingIntensity, IndirectLightingIntensity));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_VolumetricScatteringIntensity)
 		{
-			CacheVolumetricScatteringIntensity = DirectionalLight->GetLightComponent()->VolumetricScatteringIntensity;
+			CacheVolumetricScatteringIntensity = GetSettledLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity);
 			if (CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity)
 			{
-				DirectionalLight->GetLightComponent()->SetVolumetricScatteringIntensity(VolumetricScatteringIntensity);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity, ApplyBlendWeight(CacheVolumetricScatteringIntensity, VolumetricScatteringIntensity));
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_CastShadows)
+		{
+			bCacheCastShadows = DirectionalLight->GetLightComponent()->CastShadows;
+			if (bCacheCastShadows != CastShadows)
+			{
+				DirectionalLight->GetLightComponent()->SetCastShadows(CastShadows);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_DynamicShadowDistanceMovableLight)
+		{
+			CacheDynamicShadowDistanceMovableLight = GetDirectionalLightComponent(DirectionalLight.Get())->DynamicShadowDistanceMovableLight;
+			if (CacheDynamicShadowDistanceMovableLight != DynamicShadowDistanceMovableLight)
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowDistanceMovableLight(DynamicShadowDistanceMovableLight);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_DynamicShadowCascades)
+		{
+			CacheDynamicShadowCascades = GetDirectionalLightComponent(DirectionalLight.Get())->DynamicShadowCascades;
+			if (CacheDynamicShadowCascades != DynamicShadowCascades)
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowCascades(DynamicShadowCascades);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_FarShadowCascadeCount)
+		{
+			CacheFarShadowCascadeCount = GetDirectionalLightComponent(DirectionalLight.Get())->FarShadowCascadeCount;
+			if (CacheFarShadowCascadeCount != FarShadowCascadeCount)
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowCascadeCount(FarShadowCascadeCount);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_FarShadowDistance)
+		{
+			CacheFarShadowDistance = GetDirectionalLightComponent(DirectionalLight.Get())->FarShadowDistance;
+			if (CacheFarShadowDistance != FarShadowDistance)
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowDistance(FarShadowDistance);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_ShadowResolutionScale)
+		{
+			CacheShadowResolutionScale = DirectionalLight->GetLightComponent()->ShadowResolutionScale;
+			if (CacheShadowResolutionScale != ShadowResolutionScale)
+			{
+				DirectionalLight->GetLightComponent()->ShadowResolutionScale = ShadowResolutionScale;
+				DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_ContactShadowLength)
+		{
+			CacheContactShadowLength = DirectionalLight->GetLightComponent()->ContactShadowLength;
+			if (CacheContactShadowLength != ContactShadowLength)
+			{
+				DirectionalLight->GetLightComponent()->ContactShadowLength = ContactShadowLength;
+				DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				RecordDebugMutation();
 				bOverridingLighting |= true;
 			}
 		}
@@ -106,45 +216,146 @@ void ALocalDirectionalLightVolume::OverrideLighting()
 
 void ALocalDirectionalLightVolume::RestoreLighting()
 {
+	if (DirectionalLight.IsValid())
+	{
+		if (bOverride_Rotation)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, Rotation), CacheRotation != Rotation))
+			{
+				BlendLightProperty(DirectionalLight->GetLightComponent(), CacheRotation);
+			}
+		}
+		if (bOverride_Intensity)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, Intensity), CacheIntensity != Intensity))
+			{
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity, CacheIntensity);
+			}
+		}
+		if (bOverride_LightColor)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, LightColor), CacheLightColor != LightColor))
+			{
+				BlendLightProperty(DirectionalLight->GetLightComponent(), FLinearColor::FromSRGBColor(CacheLightColor));
+			}
+		}
+		if (bOverride_IndirectLightingIntensity)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, IndirectLightingIntensity), CacheIndirectLightingIntensity != IndirectLightingIntensity))
+			{
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity, CacheIndirectLightingIntensity);
+			}
+		}
+		if (bOverride_VolumetricScatteringIntensity)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, VolumetricScatteringIntensity), CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity))
+			{
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity, CacheVolumetricScatteringIntensity);
+			}
+		}
+		if (bOverride_CastShadows)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, CastShadows), bCacheCastShadows != CastShadows))
+			{
+				DirectionalLight->GetLightComponent()->SetCastShadows(bCacheCastShadows);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_DynamicShadowDistanceMovableLight)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DynamicShadowDistanceMovableLight), CacheDynamicShadowDistanceMovableLight != DynamicShadowDistanceMovableLight))
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowDistanceMovableLight(CacheDynamicShadowDistanceMovableLight);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_DynamicShadowCascades)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DynamicShadowCascades), CacheDynamicShadowCascades != DynamicShadowCascades))
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowCascades(CacheDynamicShadowCascades);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_FarShadowCascadeCount)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, FarShadowCascadeCount), CacheFarShadowCascadeCount != FarShadowCascadeCount))
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowCascadeCount(CacheFarShadowCascadeCount);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_FarShadowDistance)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, FarShadowDistance), CacheFarShadowDistance != FarShadowDistance))
+			{
+				GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowDistance(CacheFarShadowDistance);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_ShadowResolutionScale)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, ShadowResolutionScale), CacheShadowResolutionScale != ShadowResolutionScale))
+			{
+				DirectionalLight->GetLightComponent()->ShadowResolutionScale = CacheShadowResolutionScale;
+				DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_ContactShadowLength)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, ContactShadowLength), CacheContactShadowLength != ContactShadowLength))
+			{
+				DirectionalLight->GetLightComponent()->ContactShadowLength = CacheContactShadowLength;
+				DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				RecordDebugMutation();
+			}
+		}
+	}
+	bOverridingLighting = false;
+}
+
+void ALocalDirectionalLightVolume::UpdateBlendWeight()
+{
+	// Only the numeric overrides follow the weight, the others are applied fully as soon as the View Point enters.
 	if (DirectionalLight.IsValid())
 	{
 		if (bOverride_Rotation)
 		{
 			if (CacheRotation != Rotation)
 			{
-				DirectionalLight->GetLightComponent()->SetWorldRotation(CacheRotation);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ApplyBlendWeight(CacheRotation, Rotation));
 			}
 		}
 		if (bOverride_Intensity)
 		{
 			if (CacheIntensity != Intensity)
 			{
-				DirectionalLight->GetLightComponent()->SetIntensity(CacheIntensity);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity, ApplyBlendWeight(CacheIntensity, Intensity));
 			}
 		}
 		if (bOverride_LightColor)
 		{
 			if (CacheLightColor != LightColor)
 			{
-				DirectionalLight->GetLightComponent()->SetLightColor(FLinearColor::FromSRGBColor(CacheLightColor));
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ApplyBlendWeight(FLinearColor::FromSRGBColor(CacheLightColor), FLinearColor::FromSRGBColor(LightColor)));
 			}
 		}
 		if (bOverride_IndirectLightingIntensity)
 		{
 			if (CacheIndirectLightingIntensity != IndirectLightingIntensity)
 			{
-				DirectionalLight->GetLightComponent()->SetIndirectLightingIntensity(CacheIndirectLightingIntensity);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity, ApplyBlendWeight(CacheIndirectLightingIntensity, IndirectLightingIntensity));
 			}
 		}
 		if (bOverride_VolumetricScatteringIntensity)
 		{
 			if (CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity)
 			{
-				DirectionalLight->GetLightComponent()->SetVolumetricScatteringIntensity(CacheVolumetricScatteringIntensity);
+				BlendLightProperty(DirectionalLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity, ApplyBlendWeight(CacheVolumetricScatteringIntensity, VolumetricScatteringIntensity));
 			}
 		}
 	}
-	bOverridingLighting = false;
 }
 
 #if WITH_EDITOR
@@ -161,13 +372,27 @@ void ALocalDirectionalLightVolume::PreEditChange(FProperty* PropertyAboutToChang
 			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, Intensity) ||
 			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, LightColor) ||
 			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, IndirectLightingIntensity) ||
-			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, VolumetricScatteringIntensity))
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, VolumetricScatteringIntensity) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, CastShadows) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, DynamicShadowDistanceMovableLight) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, DynamicShadowCascades) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, FarShadowCascadeCount) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, FarShadowDistance) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, ShadowResolutionScale) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalDirectionalLightVolume, ContactShadowLength))
 		{
 			bCacheOverride_Rotation = bOverride_Rotation;
 			bCacheOverride_Intensity = bOverride_Intensity;
 			bCacheOverride_LightColor = bOverride_LightColor;
 			bCacheOverride_IndirectLightingIntensity = bOverride_IndirectLightingIntensity;
 			bCacheOverride_VolumetricScatteringIntensity = bOverride_VolumetricScatteringIntensity;
+			bCacheOverride_CastShadows = bOverride_CastShadows;
+			bCacheOverride_DynamicShadowDistanceMovableLight = bOverride_DynamicShadowDistanceMovableLight;
+			bCacheOverride_DynamicShadowCascades = bOverride_DynamicShadowCascades;
+			bCacheOverride_FarShadowCascadeCount = bOverride_FarShadowCascadeCount;
+			bCacheOverride_FarShadowDistance = bOverride_FarShadowDistance;
+			bCacheOverride_ShadowResolutionScale = bOverride_ShadowResolutionScale;
+			bCacheOverride_ContactShadowLength = bOverride_ContactShadowLength;
 		}
 	}
 	Super::PreEditChange(PropertyAboutToChange);
@@ -180,6 +405,16 @@ void ALocalDirectionalLightVolume::PostEditChangeProperty(FPropertyChangedEvent&
 	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
 	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
 
+	// The Directional Lights are written directly below, a running transition would overwrite the edit.
+	if (bViewPointInVolume && DirectionalLight.IsValid())
+	{
+		SettleLightTransitions(DirectionalLight->GetLightComponent());
+	}
+	if (bViewPointInVolume && CacheDirectionalLight.IsValid())
+	{
+		SettleLightTransitions(CacheDirectionalLight->GetLightComponent());
+	}
+
 	if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DirectionalLight))
 	{
 		if (bViewPointInVolume && CacheDirectionalLight != DirectionalLight)
@@ -222,6 +457,57 @@ void ALocalDirectionalLightVolume::PostEditChangeProperty(FPropertyChangedEvent&
 						CacheDirectionalLight->GetLightComponent()->SetVolumetricScatteringIntensity(CacheVolumetricScatteringIntensity);
 					}
 				}
+				if (bOverride_CastShadows)
+				{
+					if (bCacheCastShadows != CastShadows)
+					{
+						CacheDirectionalLight->GetLightComponent()->SetCastShadows(bCacheCastShadows);
+					}
+				}
+				if (bOverride_DynamicShadowDistanceMovableLight)
+				{
+					if (CacheDynamicShadowDistanceMovableLight != DynamicShadowDistanceMovableLight)
+					{
+						GetDirectionalLightComponent(CacheDirectionalLight.Get())->SetDynamicShadowDistanceMovableLight(CacheDynamicShadowDistanceMovableLight);
+					}
+				}
+				if (bOverride_DynamicShadowCascades)
+				{
+					if (CacheDynamicShadowCascades != DynamicShadowCascades)
+					{
+						GetDirectionalLightComponent(CacheDirectionalLight.Get())->SetDynamicShadowCascades(CacheDynamicShadowCascades);
+					}
+				}
+				if (bOverride_FarShadowCascadeCount)
+				{
+					if (CacheFarShadowCascadeCount != FarShadowCascadeCount)
+					{
+						GetDirectionalLightComponent(CacheDirectionalLight.Get())->SetFarShadowCascadeCount(CacheFarShadowCascadeCount);
+					}
+				}
+				if (bOverride_FarShadowDistance)
+				{
+					if (CacheFarShadowDistance != FarShadowDistance)
+					{
+						GetDirectionalLightComponent(CacheDirectionalLight.Get())->SetFarShadowDistance(CacheFarShadowDistance);
+					}
+				}
+				if (bOverride_ShadowResolutionScale)
+				{
+					if (CacheShadowResolutionScale != ShadowResolutionScale)
+					{
+						CacheDirectionalLight->GetLightComponent()->ShadowResolutionScale = CacheShadowResolutionScale;
+						CacheDirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+					}
+				}
+				if (bOverride_ContactShadowLength)
+				{
+					if (CacheContactShadowLength != ContactShadowLength)
+					{
+						CacheDirectionalLight->GetLightComponent()->ContactShadowLength = CacheContactShadowLength;
+						CacheDirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+					}
+				}
 			}
 			OverrideLighting();
 		}
@@ -319,6 +605,136 @@ void ALocalDirectionalLightVolume::PostEditChangeProperty(FPropertyChangedEvent&
 				}
 			}
 		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, CastShadows))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_CastShadows)
+				{
+					if (bOverride_CastShadows != bCacheOverride_CastShadows)
+					{
+						bCacheCastShadows = DirectionalLight->GetLightComponent()->CastShadows;
+					}
+					DirectionalLight->GetLightComponent()->SetCastShadows(CastShadows);
+				}
+				else
+				{
+					DirectionalLight->GetLightComponent()->SetCastShadows(bCacheCastShadows);
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DynamicShadowDistanceMovableLight))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_DynamicShadowDistanceMovableLight)
+				{
+					if (bOverride_DynamicShadowDistanceMovableLight != bCacheOverride_DynamicShadowDistanceMovableLight)
+					{
+						CacheDynamicShadowDistanceMovableLight = GetDirectionalLightComponent(DirectionalLight.Get())->DynamicShadowDistanceMovableLight;
+					}
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowDistanceMovableLight(DynamicShadowDistanceMovableLight);
+				}
+				else
+				{
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowDistanceMovableLight(CacheDynamicShadowDistanceMovableLight);
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DynamicShadowCascades))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_DynamicShadowCascades)
+				{
+					if (bOverride_DynamicShadowCascades != bCacheOverride_DynamicShadowCascades)
+					{
+						CacheDynamicShadowCascades = GetDirectionalLightComponent(DirectionalLight.Get())->DynamicShadowCascades;
+					}
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowCascades(DynamicShadowCascades);
+				}
+				else
+				{
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetDynamicShadowCascades(CacheDynamicShadowCascades);
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, FarShadowCascadeCount))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_FarShadowCascadeCount)
+				{
+					if (bOverride_FarShadowCascadeCount != bCacheOverride_FarShadowCascadeCount)
+					{
+						CacheFarShadowCascadeCount = GetDirectionalLightComponent(DirectionalLight.Get())->FarShadowCascadeCount;
+					}
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowCascadeCount(FarShadowCascadeCount);
+				}
+				else
+				{
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowCascadeCount(CacheFarShadowCascadeCount);
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, FarShadowDistance))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_FarShadowDistance)
+				{
+					if (bOverride_FarShadowDistance != bCacheOverride_FarShadowDistance)
+					{
+						CacheFarShadowDistance = GetDirectionalLightComponent(DirectionalLight.Get())->FarShadowDistance;
+					}
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowDistance(FarShadowDistance);
+				}
+				else
+				{
+					GetDirectionalLightComponent(DirectionalLight.Get())->SetFarShadowDistance(CacheFarShadowDistance);
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, ShadowResolutionScale))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_ShadowResolutionScale)
+				{
+					if (bOverride_ShadowResolutionScale != bCacheOverride_ShadowResolutionScale)
+					{
+						CacheShadowResolutionScale = DirectionalLight->GetLightComponent()->ShadowResolutionScale;
+					}
+					DirectionalLight->GetLightComponent()->ShadowResolutionScale = ShadowResolutionScale;
+					DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				}
+				else
+				{
+					DirectionalLight->GetLightComponent()->ShadowResolutionScale = CacheShadowResolutionScale;
+					DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, ContactShadowLength))
+		{
+			if (DirectionalLight.IsValid())
+			{
+				if (bOverride_ContactShadowLength)
+				{
+					if (bOverride_ContactShadowLength != bCacheOverride_ContactShadowLength)
+					{
+						CacheContactShadowLength = DirectionalLight->GetLightComponent()->ContactShadowLength;
+					}
+					DirectionalLight->GetLightComponent()->ContactShadowLength = ContactShadowLength;
+					DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				}
+				else
+				{
+					DirectionalLight->GetLightComponent()->ContactShadowLength = CacheContactShadowLength;
+					DirectionalLight->GetLightComponent()->MarkRenderStateDirty();
+				}
+			}
+		}
 	}
 }
 
@@ -329,7 +745,14 @@ bool ALocalDirectionalLightVolume::CanEditChange(const FProperty* InProperty) co
 		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, Intensity) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, LightColor) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, IndirectLightingIntensity) ||
-		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, VolumetricScatteringIntensity))
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, VolumetricScatteringIntensity) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, CastShadows) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DynamicShadowDistanceMovableLight) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, DynamicShadowCascades) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, FarShadowCascadeCount) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, FarShadowDistance) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, ShadowResolutionScale) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalDirectionalLightVolume, ContactShadowLength))
 	{
 		return DirectionalLight.IsValid();
 	}
@@ -0,0 +1,170 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalExponentialHeightFogVolume.h"
+
+// Engine Include
+#include "Components/BrushComponent.h"
+#include "Components/ExponentialHeightFogComponent.h"
+#include "Engine/ExponentialHeightFog.h"
+
+static UExponentialHeightFogComponent* GetExponentialHeightFogComponent(AExponentialHeightFog* ExponentialHeightFog)
+{
+	return ExponentialHeightFog->GetComponent();
+}
+
+ALocalExponentialHeightFogVolume::ALocalExponentialHeightFogVolume()
+{
+	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+	GetBrushComponent()->Mobility = EComponentMobility::Movable;
+
+	bOverride_bVisible = false;
+	bOverride_FogDensity = false;
+	bOverride_bEnableVolumetricFog = false;
+	bOverride_VolumetricFogDistance = false;
+
+	ExponentialHeightFog = nullptr;
+	bVisible = true;
+	FogDensity = 0.02f;
+	bEnableVolumetricFog = false;
+	VolumetricFogDistance = 6000.0f;
+
+	bCacheVisible = true;
+	CacheFogDensity = 0.02f;
+	bCacheEnableVolumetricFog = false;
+	CacheVolumetricFogDistance = 6000.0f;
+}
+
+AActor* ALocalExponentialHeightFogVolume::GetOverrideTarget() const
+{
+	return ExponentialHeightFog.Get();
+}
+
+void ALocalExponentialHeightFogVolume::OverrideLighting()
+{
+	bOverridingLighting = false;
+	if (UExponentialHeightFogComponent* Component = ExponentialHeightFog.IsValid() ? GetExponentialHeightFogComponent(ExponentialHeightFog.Get()) : nullptr)
+	{
+		if (bOverride_bVisible)
+		{
+			bCacheVisible = Component->GetVisibleFlag();
+			if (bCacheVisible != bVisible)
+			{
+				Component->SetVisibility(bVisible);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_FogDensity)
+		{
+			CacheFogDensity = Component->FogDensity;
+			if (CacheFogDensity != FogDensity)
+			{
+				Component->SetFogDensity(FogDensity);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_bEnableVolumetricFog)
+		{
+			bCacheEnableVolumetricFog = Component->bEnableVolumetricFog;
+			if (bCacheEnableVolumetricFog != bEnableVolumetricFog)
+			{
+				Component->SetVolumetricFog(bEnableVolumetricFog);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_VolumetricFogDistance)
+		{
+			CacheVolumetricFogDistance = Component->VolumetricFogDistance;
+			if (CacheVolumetricFogDistance != VolumetricFogDistance)
+			{
+				Component->SetVolumetricFogDistance(VolumetricFogDistance);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+	}
+}
+
+void ALocalExponentialHeightFogVolume::RestoreLighting()
+{
+	if (UExponentialHeightFogComponent* Component = ExponentialHeightFog.IsValid() ? GetExponentialHeightFogComponent(ExponentialHeightFog.Get()) : nullptr)
+	{
+		if (bOverride_bVisible)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, bVisible), bCacheVisible != bVisible))
+			{
+				Component->SetVisibility(bCacheVisible);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_FogDensity)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, FogDensity), CacheFogDensity != FogDensity))
+			{
+				Component->SetFogDensity(CacheFogDensity);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_bEnableVolumetricFog)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, bEnableVolumetricFog), bCacheEnableVolumetricFog != bEnableVolumetricFog))
+			{
+				Component->SetVolumetricFog(bCacheEnableVolumetricFog);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_VolumetricFogDistance)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, VolumetricFogDistance), CacheVolumetricFogDistance != VolumetricFogDistance))
+			{
+				Component->SetVolumetricFogDistance(CacheVolumetricFogDistance);
+				RecordDebugMutation();
+			}
+		}
+	}
+	bOverridingLighting = false;
+}
+
+#if WITH_EDITOR
+void ALocalExponentialHeightFogVolume::PreEditChange(FProperty* PropertyAboutToChange)
+{
+	// The fog overrides are few and cheap to set, undo all of them rather than tracking which one is edited.
+	if (bViewPointInVolume)
+	{
+		RestoreLighting();
+	}
+	Super::PreEditChange(PropertyAboutToChange);
+}
+
+void ALocalExponentialHeightFogVolume::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (bViewPointInVolume)
+	{
+		OverrideLighting();
+	}
+}
+
+bool ALocalExponentialHeightFogVolume::CanEditChange(const FProperty* InProperty) const
+{
+	const FName PropertyName = InProperty->GetFName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, bVisible) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, FogDensity) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, bEnableVolumetricFog) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalExponentialHeightFogVolume, VolumetricFogDistance))
+	{
+		return ExponentialHeightFog.IsValid();
+	}
+
+	return Super::CanEditChange(InProperty);
+}
+#endif
@@ -0,0 +1,137 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingSequenceBake.h"
+
+// Engine Include
+#include "Algo/BinarySearch.h"
+#include "Camera/CameraComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "LevelSequence.h"
+#include "LevelSequenceActor.h"
+#include "LevelSequencePlayer.h"
+#include "MovieScene.h"
+#include "MovieSceneTimeHelpers.h"
+#include "Tracks/MovieSceneCameraCutTrack.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+#include "LocalLightingVolume.h"
+
+int32 ULocalLightingSequenceBake::FindKey(double Time) const
+{
+	return Algo::UpperBoundBy(Keys, Time, &FLocalLightingBakedKey::Time) - 1;
+}
+
+#if WITH_EDITOR
+bool ULocalLightingSequenceBake::Bake(UWorld* World)
+{
+	ULevelSequence* LevelSequence = Sequence.LoadSynchronous();
+	UMovieScene* MovieScene = LevelSequence ? LevelSequence->GetMovieScene() : nullptr;
+	if (!World || !MovieScene)
+	{
+		UE_LOG(LogLocalLightingVolume, Warning, TEXT("Can not bake %s, no World or Level Sequence."), *GetName());
+		return false;
+	}
+
+	const FFrameRate TickResolution = MovieScene->GetTickResolution();
+	const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+	const FFrameNumber StartFrame = ConvertFrameTime(UE::MovieScene::DiscreteInclusiveLower(MovieScene->GetPlaybackRange()), TickResolution, DisplayRate).FloorToFrame();
+	const FFrameNumber EndFrame = ConvertFrameTime(UE::MovieScene::DiscreteExclusiveUpper(MovieScene->GetPlaybackRange()), TickResolution, DisplayRate).FloorToFrame();
+
+	TArray<FFrameNumber> CameraCutFrames;
+	if (UMovieSceneCameraCutTrack* CameraCutTrack = Cast<UMovieSceneCameraCutTrack>(MovieScene->GetCameraCutTrack()))
+	{
+		for (const UMovieSceneSection* Section : CameraCutTrack->GetAllSections())
+		{
+			if (Section->HasStartFrame())
+			{
+				CameraCutFrames.AddUnique(ConvertFrameTime(Section->GetInclusiveStartFrame(), TickResolution, DisplayRate).FloorToFrame());
+			}
+		}
+	}
+
+	TArray<ALocalLightingVolumeBase*> Volumes;
+	for (TActorIterator<ALocalLightingVolumeBase> It(World); It; ++It)
+	{
+		Volumes.Add(*It);
+	}
+
+	// Restore the state of everything the Sequence animates once baked, the World may be an editor World.
+	FMovieSceneSequencePlaybackSettings PlaybackSettings;
+	PlaybackSettings.bRestoreState = true;
+	ALevelSequenceActor* SequenceActor = nullptr;
+	ULevelSequencePlayer* Player = ULevelSequencePlayer::CreateLevelSequencePlayer(World, LevelSequence, PlaybackSettings, SequenceActor);
+	if (!Player)
+	{
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+	Modify();
+	Keys.Reset();
+
+	const int32 Interval = FMath::Max(SampleInterval, 1);
+	for (int32 FrameValue = StartFrame.Value; FrameValue < EndFrame.Value; FrameValue++)
+	{
+		const FFrameNumber Frame(FrameValue);
+		const bool bCameraCut = CameraCutFrames.Contains(Frame);
+		if (!bCameraCut && (FrameValue - StartFrame.Value) % Interval != 0)
+		{
+			continue;
+		}
+
+		Player->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(FFrameTime(Frame), EUpdatePositionMethod::Jump));
+		const UCameraComponent* Camera = Player->GetActiveCameraComponent();
+		if (!Camera)
+		{
+			continue;
+		}
+
+		FLocalLightingBakedKey Key;
+		Key.Time = Player->GetCurrentTime().AsSeconds();
+		Key.bCameraCut = bCameraCut;
+		const FVector ViewPoint = Camera->GetComponentLocation();
+		for (const ALocalLightingVolumeBase* Volume : Volumes)
+		{
+			if (Volume->EncompassesViewPoint(ViewPoint))
+			{
+				Key.ActiveVolumes.Add(FSoftObjectPath(UWorld::RemovePIEPrefix(Volume->GetPathName())));
+			}
+		}
+
+		if (Keys.Num() == 0 || Key.bCameraCut || Keys.Last().ActiveVolumes != Key.ActiveVolumes)
+		{
+			Keys.Add(MoveTemp(Key));
+		}
+	}
+
+	Player->Stop();
+	SequenceActor->Destroy();
+
+	MarkPackageDirty();
+	UE_LOG(LogLocalLightingVolume, Log, TEXT("Baked %d keys from %s."), Keys.Num(), *LevelSequence->GetName());
+	return true;
+}
+
+void ULocalLightingSequenceBake::BakeInEditorWorld()
+{
+	for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+	{
+		if (WorldContext.WorldType == EWorldType::Editor)
+		{
+			Bake(WorldContext.World());
+			return;
+		}
+	}
+	UE_LOG(LogLocalLightingVolume, Warning, TEXT("Can not bake %s, no World is opened in the editor."), *GetName());
+}
+#endif
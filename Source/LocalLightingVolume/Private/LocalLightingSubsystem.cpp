@@ -9,10 +9,176 @@
 #include "LocalLightingSubsystem.h"
 
 // Engine Include
+#include "Camera/PlayerCameraManager.h"
+#include "Components/SceneComponent.h"
+#include "Components/SkyLightComponent.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/Texture.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "LevelSequencePlayer.h"
 #include "Subsystems/SubsystemBlueprintLibrary.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+// Plugins Include
+#include "LocalConsoleVariableOverrides.h"
+#include "LocalLightingOverrideDiff.h"
+#include "LocalLightingSequenceBake.h"
+#include "LocalLightingVolume.h"
+#include "LocalLightingVolumeInstancesComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Process Volumes"), STAT_LocalLightingVolume_ProcessVolumes, STATGROUP_LocalLightingVolume);
+DECLARE_CYCLE_STAT(TEXT("Register Volume"), STAT_LocalLightingVolume_RegisterVolume, STATGROUP_LocalLightingVolume);
+DECLARE_CYCLE_STAT(TEXT("Unregister Volume"), STAT_LocalLightingVolume_UnregisterVolume, STATGROUP_LocalLightingVolume);
+DECLARE_CYCLE_STAT(TEXT("Resolve View Overrides"), STAT_LocalLightingVolume_ResolveViewOverrides, STATGROUP_LocalLightingVolume);
+DECLARE_CYCLE_STAT(TEXT("Flush Pending Volumes"), STAT_LocalLightingVolume_FlushPendingVolumes, STATGROUP_LocalLightingVolume);
+DECLARE_CYCLE_STAT(TEXT("Capture Snapshot"), STAT_LocalLightingVolume_CaptureSnapshot, STATGROUP_LocalLightingVolume);
+DECLARE_CYCLE_STAT(TEXT("Apply Snapshot"), STAT_LocalLightingVolume_ApplySnapshot, STATGROUP_LocalLightingVolume);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sky Captures Requested"), STAT_LocalLightingVolume_SkyCapturesRequested, STATGROUP_LocalLightingVolume);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sky Captures Executed"), STAT_LocalLightingVolume_SkyCapturesExecuted, STATGROUP_LocalLightingVolume);
+DECLARE_MEMORY_STAT(TEXT("Brush Volumes Memory"), STAT_LocalLightingVolume_BrushMemory, STATGROUP_LocalLightingVolume);
+DECLARE_MEMORY_STAT(TEXT("Analytic Volumes Memory"), STAT_LocalLightingVolume_AnalyticMemory, STATGROUP_LocalLightingVolume);
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeEvaluationRate(
+	TEXT("r.LocalLightingVolume.EvaluationRate"),
+	20.0f,
+	TEXT("Rate in Hz at which Local Lighting Volumes are evaluated when a View Point provider is bound to the subsystem.\n")
+	TEXT("0 evaluates every World tick."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLocalLightingVolumePerViewOverrides(
+	TEXT("r.LocalLightingVolume.PerViewOverrides"),
+	0,
+	TEXT("0: Volumes only override the light components, shared by every View (default).\n")
+	TEXT("1: Only the View overrides of the Volumes (indirect lighting intensity and color) are resolved per View and applied to its post process settings\n")
+	TEXT("on the render thread. Every light component is left untouched, the Volumes entered when switching are left."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeSkyCaptureMinInterval(
+	TEXT("r.LocalLightingVolume.SkyCapture.MinInterval"),
+	0.5f,
+	TEXT("Minimum time in seconds between two Sky Light recaptures requested by Local Lighting Volumes.\n")
+	TEXT("Requests made in between are coalesced into the next capture."),
+	ECVF_Default);
+
+static void DumpLocalLightingVolumeMemory(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	struct FVolumeMemory
+	{
+		int32 Count = 0;
+		SIZE_T Bytes = 0;
+		TSet<UTexture*> Textures;
+	};
+
+	// Grouped per Level, then per class, so that Volumes can be budgeted per map.
+	TMap<TPair<FString, FString>, FVolumeMemory> VolumeMemories;
+	// Grouped per Shape, so that Brush Volumes can be compared with analytic ones.
+	TMap<ELocalLightingVolumeShape, FVolumeMemory> ShapeMemories;
+	for (TActorIterator<ALocalLightingVolumeBase> It(World); It; ++It)
+	{
+		ALocalLightingVolumeBase* Volume = *It;
+		const SIZE_T Bytes = Volume->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		FVolumeMemory& VolumeMemory = VolumeMemories.FindOrAdd(TPair<FString, FString>(Volume->GetLevel()->GetOutermost()->GetName(), Volume->GetClass()->GetName()));
+		VolumeMemory.Count++;
+		VolumeMemory.Bytes += Bytes;
+
+		FVolumeMemory& ShapeMemory = ShapeMemories.FindOrAdd(Volume->GetShape());
+		ShapeMemory.Count++;
+		ShapeMemory.Bytes += Bytes;
+
+		TArray<UTexture*> Textures;
+		Volume->GetReferencedTextures(Textures);
+		VolumeMemory.Textures.Append(Textures);
+	}
+
+	VolumeMemories.KeySort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+	{
+		return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+	});
+
+	Ar.Logf(TEXT("Local Lighting Volumes of %s:"), *World->GetName());
+	Ar.Logf(TEXT("%-48s %-40s %8s %12s %16s"), TEXT("Level"), TEXT("Class"), TEXT("Count"), TEXT("Bytes"), TEXT("Cubemap Bytes"));
+	for (TPair<TPair<FString, FString>, FVolumeMemory>& Pair : VolumeMemories)
+	{
+		SIZE_T TextureBytes = 0;
+		for (UTexture* Texture : Pair.Value.Textures)
+		{
+			TextureBytes += Texture->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+		Ar.Logf(TEXT("%-48s %-40s %8d %12llu %16llu"), *Pair.Key.Key, *Pair.Key.Value, Pair.Value.Count, (uint64)Pair.Value.Bytes, (uint64)TextureBytes);
+	}
+
+	// Sizing a Volume walks its Brush, so the memory stats are only refreshed here rather than on every registration.
+	SIZE_T BrushBytes = 0;
+	SIZE_T AnalyticBytes = 0;
+	ShapeMemories.KeySort(TLess<ELocalLightingVolumeShape>());
+	Ar.Logf(TEXT("%-16s %8s %12s %16s"), TEXT("Shape"), TEXT("Count"), TEXT("Bytes"), TEXT("Bytes per Volume"));
+	for (const TPair<ELocalLightingVolumeShape, FVolumeMemory>& Pair : ShapeMemories)
+	{
+		Ar.Logf(TEXT("%-16s %8d %12llu %16llu"), *StaticEnum<ELocalLightingVolumeShape>()->GetNameStringByValue((int64)Pair.Key), Pair.Value.Count, (uint64)Pair.Value.Bytes, (uint64)(Pair.Value.Bytes / Pair.Value.Count));
+		if (Pair.Key == ELocalLightingVolumeShape::Brush)
+		{
+			BrushBytes += Pair.Value.Bytes;
+		}
+		else
+		{
+			AnalyticBytes += Pair.Value.Bytes;
+		}
+	}
+	SET_MEMORY_STAT(STAT_LocalLightingVolume_BrushMemory, BrushBytes);
+	SET_MEMORY_STAT(STAT_LocalLightingVolume_AnalyticMemory, AnalyticBytes);
+
+	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(World))
+	{
+		Ar.Logf(TEXT("Subsystem containers: %llu bytes"), (uint64)Subsystem->GetAllocatedSize());
+	}
+	Ar.Logf(TEXT("Console Variable overrides: %llu bytes"), (uint64)FLocalConsoleVariableOverrides::Get().GetAllocatedSize());
+}
+
+/** Path of the object in a snapshot or a baked key, without PIE prefix. */
+static FSoftObjectPath GetSnapshotPath(const UObject* Object)
+{
+	return Object ? FSoftObjectPath(UWorld::RemovePIEPrefix(Object->GetPathName())) : FSoftObjectPath();
+}
+
+/** The Volume followed by every linked Volume it drives. */
+static void GetVolumeAndLinkedVolumes(ALocalLightingVolumeBase* Volume, TArray<ALocalLightingVolumeBase*, TInlineAllocator<8>>& OutVolumes)
+{
+	OutVolumes.Add(Volume);
+	for (ALocalLightingVolumeBase* LinkedVolume : Volume->GetLinkedVolumes())
+	{
+		if (IsValid(LinkedVolume) && !OutVolumes.Contains(LinkedVolume))
+		{
+			OutVolumes.Add(LinkedVolume);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpLocalLightingVolumeMemoryCommand(
+	TEXT("LocalLightingVolume.DumpMemory"),
+	TEXT("Dump the memory of the Local Lighting Volumes of the World per Level, per class and per Shape: count, bytes and referenced cubemap bytes.\n")
+	TEXT("Also refreshes the Brush and Analytic Volumes Memory stats."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&DumpLocalLightingVolumeMemory));
 
 ULocalLightingSubsystem::ULocalLightingSubsystem()
 {
+	LastEvaluationTime = -DBL_MAX;
+	BakedKeyIndex = INDEX_NONE;
+	bPerViewOverrides = false;
+	bApplyingSnapshot = false;
+	LastSkyCaptureTime = -DBL_MAX;
+#if ENABLE_DRAW_DEBUG
+	LastViewPoint = FVector::ZeroVector;
+#endif
 }
 
 bool ULocalLightingSubsystem::ShouldCreateSubsystem(UObject* Outer) const
@@ -26,7 +192,59 @@ void ULocalLightingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	Volumes.Reset();
+	ResetVolumes();
+
+	LastEvaluationTime = -DBL_MAX;
+	TickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &ULocalLightingSubsystem::OnWorldTickStart);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ULocalLightingSubsystem::OnWorldPostActorTick);
+
+	QualityLevels = Scalability::GetQualityLevels();
+	ScalabilitySinkHandle = IConsoleManager::Get().RegisterConsoleVariableSink_Handle(FConsoleCommandDelegate::CreateUObject(this, &ULocalLightingSubsystem::OnConsoleVariablesChanged));
+
+#if WITH_EDITOR
+	PreSaveHandle = UPackage::PreSavePackageWithContextEvent.AddUObject(this, &ULocalLightingSubsystem::OnPackagePreSave);
+	SavedHandle = UPackage::PackageSavedWithContextEvent.AddUObject(this, &ULocalLightingSubsystem::OnPackageSaved);
+#endif
+}
+
+void ULocalLightingSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(TickStartHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	IConsoleManager::Get().UnregisterConsoleVariableSink_Handle(ScalabilitySinkHandle);
+	ViewPointProvider.Unbind();
+	StopBakedSequence();
+
+#if WITH_EDITOR
+	UPackage::PreSavePackageWithContextEvent.Remove(PreSaveHandle);
+	UPackage::PackageSavedWithContextEvent.Remove(SavedHandle);
+#endif
+
+	ResetVolumes();
+
+	Super::Deinitialize();
+}
+
+void ULocalLightingSubsystem::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GetAllocatedSize());
+}
+
+SIZE_T ULocalLightingSubsystem::GetAllocatedSize() const
+{
+	SIZE_T AllocatedSize = Slots.GetAllocatedSize() + FreeSlots.GetAllocatedSize() + Volumes.GetAllocatedSize() + VolumeSlots.GetAllocatedSize();
+	AllocatedSize += CandidateFilter.GetAllocatedSize();
+	AllocatedSize += Transitions.GetAllocatedSize() + PendingSkyCaptures.GetAllocatedSize();
+#if WITH_EDITORONLY_DATA
+	AllocatedSize += VolumePackages.GetAllocatedSize() + VolumePackageIndices.GetAllocatedSize() + PackageVolumes.GetAllocatedSize();
+	for (const TPair<TObjectKey<UPackage>, TArray<FLocalLightingVolumeHandle>>& Pair : PackageVolumes)
+	{
+		AllocatedSize += Pair.Value.GetAllocatedSize();
+	}
+#endif
+	return AllocatedSize;
 }
 
 ULocalLightingSubsystem* ULocalLightingSubsystem::Get(UObject* WorldContextObject)
@@ -37,13 +255,39 @@ ULocalLightingSubsystem* ULocalLightingSubsystem::Get(UObject* WorldContextObjec
 
 void ULocalLightingSubsystem::ProcessVolume(const FVector& ViewPoint)
 {
-	Volumes.StableSort([](const TScriptInterface<IInterface_LocalLightingVolume>& A, const TScriptInterface<IInterface_LocalLightingVolume>& B)
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_ProcessVolumes);
+
+	FlushPendingVolumes();
+#if ENABLE_DRAW_DEBUG
+	LastViewPoint = ViewPoint;
+#endif
+
+	// Only the Volumes whose bounds contain the View Point can enter, the others skip their exact Shape.
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	CandidateFilter.GatherCandidates(ViewPoint, Candidates);
+
+	// Volumes the View Point is in are processed first, so that they restore lighting before others cache it.
+	TArray<int32, TInlineAllocator<64>> DeferredVolumes;
+	int32 CandidateIndex = 0;
+	for (int32 DenseIndex = 0; DenseIndex < Volumes.Num(); DenseIndex++)
 	{
-		return A->IsOverridingLighting() && !B->IsOverridingLighting();
-	});
-	for (TScriptInterface<IInterface_LocalLightingVolume>& Volume : Volumes)
+		const bool bCandidate = Candidates.IsValidIndex(CandidateIndex) && Candidates[CandidateIndex] == DenseIndex;
+		CandidateIndex += bCandidate ? 1 : 0;
+		if (IInterface_LocalLightingVolume* Volume = Volumes[DenseIndex].Get())
+		{
+			if (Volume->IsOverridingLighting() || Volume->IsViewPointInVolume())
+			{
+				Volume->Process(ViewPoint);
+			}
+			else if (bCandidate)
+			{
+				DeferredVolumes.Add(DenseIndex);
+			}
+		}
+	}
+	for (int32 DenseIndex : DeferredVolumes)
 	{
-		if (Volume.GetInterface())
+		if (IInterface_LocalLightingVolume* Volume = Volumes[DenseIndex].Get())
 		{
 			Volume->Process(ViewPoint);
 		}
@@ -54,10 +298,12 @@ void ULocalLightingSubsystem::RegisterVolume(IInterface_LocalLightingVolume* Vol
 {
 	if (Volume)
 	{
-		TScriptInterface<IInterface_LocalLightingVolume> Interface;
-		Interface.SetObject(Cast<UObject>(Volume));
-		Interface.SetInterface(Volume);
-		Volumes.AddUnique(Interface);
+		LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+		FPendingVolumeOperation Operation;
+		Operation.Volume = TWeakInterfacePtr<IInterface_LocalLightingVolume>(Volume);
+		Operation.bRegister = true;
+		PendingOperations.Enqueue(MoveTemp(Operation));
 	}
 }
 
@@ -65,12 +311,859 @@ void ULocalLightingSubsystem::UnregisterVolume(IInterface_LocalLightingVolume* V
 {
 	if (Volume)
 	{
-		for (auto It = Volumes.CreateIterator(); It; ++It)
+		LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+		FPendingVolumeOperation Operation;
+		Operation.Volume = TWeakInterfacePtr<IInterface_LocalLightingVolume>(Volume);
+		Operation.bRegister = false;
+		PendingOperations.Enqueue(MoveTemp(Operation));
+	}
+}
+
+void ULocalLightingSubsystem::FlushPendingVolumes()
+{
+	check(IsInGameThread());
+	if (PendingOperations.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_FlushPendingVolumes);
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+	TArray<FPendingVolumeOperation> Operations;
+	int32 NumRegistrations = 0;
+	FPendingVolumeOperation Operation;
+	while (PendingOperations.Dequeue(Operation))
+	{
+		NumRegistrations += Operation.bRegister ? 1 : 0;
+		Operations.Add(MoveTemp(Operation));
+	}
+
+	// Grow the dense arrays once for the whole batch.
+	Volumes.Reserve(Volumes.Num() + NumRegistrations);
+	VolumeSlots.Reserve(VolumeSlots.Num() + NumRegistrations);
+#if WITH_EDITORONLY_DATA
+	VolumePackages.Reserve(VolumePackages.Num() + NumRegistrations);
+	VolumePackageIndices.Reserve(VolumePackageIndices.Num() + NumRegistrations);
+#endif
+
+	// Operations are applied in order, so that a Volume registered and unregistered in the same frame ends up unregistered.
+	for (const FPendingVolumeOperation& PendingOperation : Operations)
+	{
+		IInterface_LocalLightingVolume* Volume = PendingOperation.Volume.Get();
+		if (PendingOperation.bRegister)
+		{
+			if (Volume)
+			{
+				AddVolume(Volume);
+			}
+		}
+		else if (Volume)
+		{
+			const FLocalLightingVolumeHandle Handle = Volume->GetSubsystemHandle();
+			Volume->SetSubsystemHandle(FLocalLightingVolumeHandle());
+			RemoveVolume(Handle);
+		}
+		else
+		{
+			// The Volume is gone by now, find its slot from the stale pointer it was registered with.
+			const int32 DenseIndex = Volumes.IndexOfByKey(PendingOperation.Volume);
+			if (DenseIndex != INDEX_NONE)
+			{
+				FLocalLightingVolumeHandle Handle;
+				Handle.Index = VolumeSlots[DenseIndex];
+				Handle.Generation = Slots[Handle.Index].Generation;
+				RemoveVolume(Handle);
+			}
+		}
+	}
+}
+
+bool ULocalLightingSubsystem::IsPerViewOverridesEnabled()
+{
+	return CVarLocalLightingVolumePerViewOverrides.GetValueOnGameThread() != 0;
+}
+
+bool ULocalLightingSubsystem::IsUsingPerViewOverrides() const
+{
+	return bPerViewOverrides;
+}
+
+void ULocalLightingSubsystem::ResolveViewOverrides(const FVector& ViewPoint, FLocalLightingViewOverrides& InOutOverrides)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_ResolveViewOverrides);
+
+	FlushPendingVolumes();
+#if ENABLE_DRAW_DEBUG
+	LastViewPoint = ViewPoint;
+#endif
+
+	// Only the Volumes whose bounds contain the View Point can apply, the others skip their exact Shape.
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	CandidateFilter.GatherCandidates(ViewPoint, Candidates);
+
+	struct FViewVolume
+	{
+		const ALocalLightingVolumeBase* Volume;
+		double BoundsVolume;
+	};
+	TArray<FViewVolume, TInlineAllocator<16>> ViewVolumes;
+	for (int32 DenseIndex : Candidates)
+	{
+		const ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(Volumes[DenseIndex].GetObject());
+		if (Volume && Volume->HasViewOverrides())
+		{
+			ViewVolumes.Add({ Volume, CandidateFilter.GetBounds(DenseIndex).GetVolume() });
+		}
+	}
+
+	// Every View resolves on its own, the enter order of the light components does not apply: the most local Volume wins.
+	ViewVolumes.Sort([](const FViewVolume& A, const FViewVolume& B)
+	{
+		return A.BoundsVolume > B.BoundsVolume;
+	});
+	for (const FViewVolume& ViewVolume : ViewVolumes)
+	{
+		ViewVolume.Volume->ResolveViewOverrides(ViewPoint, InOutOverrides);
+	}
+}
+
+void ULocalLightingSubsystem::AddVolume(IInterface_LocalLightingVolume* Volume)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_RegisterVolume);
+
+	if (IsValidHandle(Volume->GetSubsystemHandle()))
+	{
+		return;
+	}
+
+	int32 SlotIndex;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(false);
+	}
+	else
+	{
+		SlotIndex = Slots.AddDefaulted();
+	}
+
+	FVolumeSlot& Slot = Slots[SlotIndex];
+	Slot.DenseIndex = Volumes.Add(TWeakInterfacePtr<IInterface_LocalLightingVolume>(Volume));
+	VolumeSlots.Add(SlotIndex);
+	CandidateFilter.Add(Volume->GetShapeBounds());
+
+	FLocalLightingVolumeHandle Handle;
+	Handle.Index = SlotIndex;
+	Handle.Generation = Slot.Generation;
+	Volume->SetSubsystemHandle(Handle);
+
+#if WITH_EDITORONLY_DATA
+	const TObjectKey<UPackage> Package(Volume->_getUObject()->GetOutermost());
+	VolumePackages.Add(Package);
+	VolumePackageIndices.Add(PackageVolumes.FindOrAdd(Package).Add(Handle));
+#endif
+}
+
+void ULocalLightingSubsystem::RemoveVolume(const FLocalLightingVolumeHandle& Handle)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_UnregisterVolume);
+
+	if (!IsValidHandle(Handle))
+	{
+		return;
+	}
+
+	FVolumeSlot& Slot = Slots[Handle.Index];
+	const int32 DenseIndex = Slot.DenseIndex;
+	const int32 LastDenseIndex = Volumes.Num() - 1;
+
+#if WITH_EDITORONLY_DATA
+	const TObjectKey<UPackage> Package = VolumePackages[DenseIndex];
+	if (TArray<FLocalLightingVolumeHandle>* Handles = PackageVolumes.Find(Package))
+	{
+		// Move the last Volume of the package into the hole and redirect its index.
+		const int32 PackageIndex = VolumePackageIndices[DenseIndex];
+		Handles->RemoveAtSwap(PackageIndex);
+		if (Handles->IsValidIndex(PackageIndex))
+		{
+			VolumePackageIndices[Slots[(*Handles)[PackageIndex].Index].DenseIndex] = PackageIndex;
+		}
+		else if (Handles->Num() == 0)
+		{
+			PackageVolumes.Remove(Package);
+		}
+	}
+#endif
+
+	if (DenseIndex != LastDenseIndex)
+	{
+		// Move the last Volume into the hole and redirect its slot.
+		Volumes[DenseIndex] = Volumes[LastDenseIndex];
+		VolumeSlots[DenseIndex] = VolumeSlots[LastDenseIndex];
+		Slots[VolumeSlots[DenseIndex]].DenseIndex = DenseIndex;
+#if WITH_EDITORONLY_DATA
+		VolumePackages[DenseIndex] = VolumePackages[LastDenseIndex];
+		VolumePackageIndices[DenseIndex] = VolumePackageIndices[LastDenseIndex];
+#endif
+	}
+	Volumes.Pop(false);
+	VolumeSlots.Pop(false);
+	CandidateFilter.RemoveAtSwap(DenseIndex);
+#if WITH_EDITORONLY_DATA
+	VolumePackages.Pop(false);
+	VolumePackageIndices.Pop(false);
+#endif
+
+	Slot.DenseIndex = INDEX_NONE;
+	// Generation 0 is never handed out, so that a default constructed handle never matches.
+	Slot.Generation = FMath::Max(Slot.Generation + 1, 1u);
+	FreeSlots.Add(Handle.Index);
+}
+
+void ULocalLightingSubsystem::UpdateVolumeBounds(IInterface_LocalLightingVolume* Volume)
+{
+	check(IsInGameThread());
+	// A Volume still queued reads its bounds once its registration is flushed.
+	const FLocalLightingVolumeHandle Handle = Volume ? Volume->GetSubsystemHandle() : FLocalLightingVolumeHandle();
+	if (IsValidHandle(Handle))
+	{
+		CandidateFilter.SetBounds(Slots[Handle.Index].DenseIndex, Volume->GetShapeBounds());
+	}
+}
+
+bool ULocalLightingSubsystem::IsValidHandle(const FLocalLightingVolumeHandle& Handle) const
+{
+	return Slots.IsValidIndex(Handle.Index) && Slots[Handle.Index].Generation == Handle.Generation && Slots[Handle.Index].DenseIndex != INDEX_NONE;
+}
+
+int32 ULocalLightingSubsystem::GetNumVolumes() const
+{
+	return Volumes.Num();
+}
+
+bool ULocalLightingSubsystem::HasVolumes() const
+{
+	return Volumes.Num() > 0 || !PendingOperations.IsEmpty();
+}
+
+void ULocalLightingSubsystem::SetViewPointProvider(const FLocalLightingViewPointProvider& Provider)
+{
+	ViewPointProvider = Provider;
+	// Evaluate on the next tick rather than waiting for a whole interval.
+	LastEvaluationTime = -DBL_MAX;
+}
+
+void ULocalLightingSubsystem::ClearViewPointProvider()
+{
+	ViewPointProvider.Unbind();
+}
+
+bool ULocalLightingSubsystem::HasViewPointProvider() const
+{
+	return ViewPointProvider.IsBound();
+}
+
+FLocalLightingTransitions& ULocalLightingSubsystem::GetTransitions()
+{
+	return Transitions;
+}
+
+void ULocalLightingSubsystem::RequestSkyCapture(USkyLightComponent* SkyLightComponent, bool bCoveredByRealTimeCapture, const ALocalLightingVolumeBase* Requester)
+{
+	if (SkyLightComponent)
+	{
+		LLM_SCOPE_BYTAG(LocalLightingVolume);
+		INC_DWORD_STAT(STAT_LocalLightingVolume_SkyCapturesRequested);
+
+		FPendingSkyCapture* PendingSkyCapture = PendingSkyCaptures.FindByPredicate([SkyLightComponent](const FPendingSkyCapture& Pending)
+		{
+			return Pending.SkyLightComponent == SkyLightComponent;
+		});
+		if (!PendingSkyCapture)
+		{
+			PendingSkyCapture = &PendingSkyCaptures.AddDefaulted_GetRef();
+			PendingSkyCapture->SkyLightComponent = SkyLightComponent;
+		}
+		PendingSkyCapture->bCoveredByRealTimeCapture &= bCoveredByRealTimeCapture;
+#if ENABLE_DRAW_DEBUG
+		if (Requester && FLocalLightingVolumeDebugCounters::IsEnabled())
+		{
+			PendingSkyCapture->Requesters.AddUnique(Requester);
+		}
+#endif
+	}
+}
+
+void ULocalLightingSubsystem::FlushSkyCaptures()
+{
+	for (const FPendingSkyCapture& PendingSkyCapture : PendingSkyCaptures)
+	{
+		USkyLightComponent* SkyLightComponent = PendingSkyCapture.SkyLightComponent.Get();
+		// A real time capture of the scene picks up the lower hemisphere on its own, time sliced when r.SkyLight.RealTimeReflectionCapture.TimeSlice is set,
+		// a full capture on top of it would only hitch. The source, its cubemap and the resolution still need one.
+		const bool bCoveredByRealTimeCapture = PendingSkyCapture.bCoveredByRealTimeCapture && SkyLightComponent &&
+			SkyLightComponent->IsRealTimeCaptureEnabled() && SkyLightComponent->SourceType == SLS_CapturedScene;
+		if (SkyLightComponent && !bCoveredByRealTimeCapture)
+		{
+			INC_DWORD_STAT(STAT_LocalLightingVolume_SkyCapturesExecuted);
+			SkyLightComponent->SetCaptureIsDirty();
+#if ENABLE_DRAW_DEBUG
+			for (const TWeakObjectPtr<const ALocalLightingVolumeBase>& Requester : PendingSkyCapture.Requesters)
+			{
+				if (const ALocalLightingVolumeBase* Volume = Requester.Get())
+				{
+					const_cast<ALocalLightingVolumeBase*>(Volume)->GetDebugCounters().Add(ELocalLightingDebugEvent::SkyRecapture);
+				}
+			}
+#endif
+		}
+	}
+	PendingSkyCaptures.Reset();
+}
+
+FLocalLightingSnapshot ULocalLightingSubsystem::CaptureSnapshot()
+{
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_CaptureSnapshot);
+
+	FlushPendingVolumes();
+
+	TArray<ALocalLightingVolumeBase*, TInlineAllocator<16>> ActiveVolumes;
+	for (const TWeakInterfacePtr<IInterface_LocalLightingVolume>& WeakVolume : Volumes)
+	{
+		ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(WeakVolume.GetObject());
+		if (Volume && Volume->IsViewPointInVolume())
+		{
+			ActiveVolumes.Add(Volume);
+		}
+	}
+	ActiveVolumes.Sort([](const ALocalLightingVolumeBase& A, const ALocalLightingVolumeBase& B)
+	{
+		return A.GetEnterOrder() < B.GetEnterOrder();
+	});
+
+	FLocalLightingSnapshot Snapshot;
+	for (ALocalLightingVolumeBase* ActiveVolume : ActiveVolumes)
+	{
+		FLocalLightingVolumeSnapshot& VolumeSnapshot = Snapshot.Volumes.AddDefaulted_GetRef();
+		VolumeSnapshot.Volume = GetSnapshotPath(ActiveVolume);
+		VolumeSnapshot.BlendWeight = ActiveVolume->GetAppliedBlendWeight();
+
+		TArray<ALocalLightingVolumeBase*, TInlineAllocator<8>> TargetVolumes;
+		GetVolumeAndLinkedVolumes(ActiveVolume, TargetVolumes);
+		for (const ALocalLightingVolumeBase* Volume : TargetVolumes)
+		{
+			if (!Volume->IsViewPointInVolume())
+			{
+				continue;
+			}
+
+			const FSoftObjectPath TargetPath = GetSnapshotPath(Volume->GetOverrideTarget());
+			FLocalLightingTargetSnapshot* TargetSnapshot = Snapshot.Targets.FindByPredicate([&TargetPath](const FLocalLightingTargetSnapshot& Other)
+			{
+				return Other.Target == TargetPath;
+			});
+			if (!TargetSnapshot)
+			{
+				TargetSnapshot = &Snapshot.Targets.AddDefaulted_GetRef();
+				TargetSnapshot->Target = TargetPath;
+			}
+
+			// The Volume entered first cached the value before any override, later ones cached the overrides below them.
+			FLocalLightingOverridePayload CachePayload;
+			Volume->GetCachePayload(CachePayload);
+			for (TPair<FName, FString>& Pair : CachePayload)
+			{
+				if (!TargetSnapshot->BaselineValues.Contains(Pair.Key))
+				{
+					TargetSnapshot->BaselineValues.Add(Pair.Key, MoveTemp(Pair.Value));
+				}
+			}
+		}
+	}
+	return Snapshot;
+}
+
+bool ULocalLightingSubsystem::ApplySnapshot(const FLocalLightingSnapshot& Snapshot)
+{
+	if (IsPlayingBakedSequence() || bPerViewOverrides)
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_LocalLightingVolume_ApplySnapshot);
+
+	FlushPendingVolumes();
+	// Nothing may keep blending towards the lighting being replaced.
+	Transitions.Settle();
+	TGuardValue<bool> ApplyingSnapshotGuard(bApplyingSnapshot, true);
+
+	TMap<FSoftObjectPath, ALocalLightingVolumeBase*> VolumesByPath;
+	TMultiMap<FSoftObjectPath, ALocalLightingVolumeBase*> VolumesByTarget;
+	TArray<ALocalLightingVolumeBase*, TInlineAllocator<16>> ActiveVolumes;
+	for (const TWeakInterfacePtr<IInterface_LocalLightingVolume>& WeakVolume : Volumes)
+	{
+		ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(WeakVolume.GetObject());
+		if (!Volume)
+		{
+			continue;
+		}
+
+		VolumesByPath.Add(GetSnapshotPath(Volume), Volume);
+		if (Volume->IsViewPointInVolume())
+		{
+			ActiveVolumes.Add(Volume);
+		}
+
+		TArray<ALocalLightingVolumeBase*, TInlineAllocator<8>> TargetVolumes;
+		GetVolumeAndLinkedVolumes(Volume, TargetVolumes);
+		for (ALocalLightingVolumeBase* TargetVolume : TargetVolumes)
+		{
+			if (const AActor* Target = TargetVolume->GetOverrideTarget())
+			{
+				VolumesByTarget.Add(GetSnapshotPath(Target), TargetVolume);
+			}
+		}
+	}
+
+	ActiveVolumes.Sort([](const ALocalLightingVolumeBase& A, const ALocalLightingVolumeBase& B)
+	{
+		return A.GetEnterOrder() < B.GetEnterOrder();
+	});
+
+	// The Volumes already active in the order and at the weight of the snapshot keep their overrides and caches,
+	// only the Volumes past the first difference leave and enter, e.g. none when applying the lighting the World is in.
+	int32 NumKeptVolumes = 0;
+	while (NumKeptVolumes < ActiveVolumes.Num() && NumKeptVolumes < Snapshot.Volumes.Num())
+	{
+		const FLocalLightingVolumeSnapshot& VolumeSnapshot = Snapshot.Volumes[NumKeptVolumes];
+		const ALocalLightingVolumeBase* Volume = ActiveVolumes[NumKeptVolumes];
+		if (VolumesByPath.FindRef(VolumeSnapshot.Volume) != Volume || Volume->GetAppliedBlendWeight() != VolumeSnapshot.BlendWeight)
+		{
+			break;
+		}
+		NumKeptVolumes++;
+	}
+
+	// Leave in reverse order of entering, so that every light unwinds back to the value it had before the first override.
+	for (int32 Index = ActiveVolumes.Num() - 1; Index >= NumKeptVolumes; Index--)
+	{
+		ActiveVolumes[Index]->ForceExit();
+	}
+
+	// The overrides of the kept Volumes are still applied on top of their cached values, their baseline is already right.
+	TMultiMap<FSoftObjectPath, FName> KeptOverrides;
+	for (int32 Index = 0; Index < NumKeptVolumes; Index++)
+	{
+		TArray<ALocalLightingVolumeBase*, TInlineAllocator<8>> TargetVolumes;
+		GetVolumeAndLinkedVolumes(ActiveVolumes[Index], TargetVolumes);
+		for (const ALocalLightingVolumeBase* Volume : TargetVolumes)
+		{
+			FLocalLightingOverridePayload Payload;
+			Volume->GetOverridePayload(Payload);
+			const FSoftObjectPath TargetPath = GetSnapshotPath(Volume->GetOverrideTarget());
+			for (const TPair<FName, FString>& Pair : Payload)
+			{
+				KeptOverrides.AddUnique(TargetPath, Pair.Key);
+			}
+		}
+	}
+
+	// Actors changed while their Volumes were not loaded, e.g. across a sublevel transition, land on the baseline of the snapshot.
+	for (const FLocalLightingTargetSnapshot& TargetSnapshot : Snapshot.Targets)
+	{
+		if (TargetSnapshot.Target.IsNull() || TargetSnapshot.BaselineValues.Num() == 0)
+		{
+			continue;
+		}
+
+		TMap<FName, FString> BaselineValues = TargetSnapshot.BaselineValues;
+		TArray<FName, TInlineAllocator<16>> TargetKeptOverrides;
+		KeptOverrides.MultiFind(TargetSnapshot.Target, TargetKeptOverrides);
+		for (const FName& OverrideName : TargetKeptOverrides)
+		{
+			BaselineValues.Remove(OverrideName);
+		}
+
+		TArray<ALocalLightingVolumeBase*, TInlineAllocator<8>> TargetVolumes;
+		VolumesByTarget.MultiFind(TargetSnapshot.Target, TargetVolumes);
+		for (int32 Index = 0; Index < TargetVolumes.Num() && BaselineValues.Num() > 0; Index++)
+		{
+			TargetVolumes[Index]->RestoreBaseline(BaselineValues);
+		}
+	}
+
+	int32 NumSkippedVolumes = 0;
+	for (int32 Index = NumKeptVolumes; Index < Snapshot.Volumes.Num(); Index++)
+	{
+		const FLocalLightingVolumeSnapshot& VolumeSnapshot = Snapshot.Volumes[Index];
+		if (ALocalLightingVolumeBase* const* Volume = VolumesByPath.Find(VolumeSnapshot.Volume))
+		{
+			(*Volume)->ForceEnterWithBlendWeight(VolumeSnapshot.BlendWeight);
+		}
+		else
+		{
+			NumSkippedVolumes++;
+		}
+	}
+	if (NumSkippedVolumes > 0)
+	{
+		UE_LOG(LogLocalLightingVolume, Verbose, TEXT("%d Volumes of the snapshot are not registered in %s and were skipped."), NumSkippedVolumes, *GetNameSafe(GetWorld()));
+	}
+
+	// Every Sky Light invalidated by the apply is captured once, right away.
+	FlushSkyCaptures();
+	return true;
+}
+
+bool ULocalLightingSubsystem::IsApplyingSnapshot() const
+{
+	return bApplyingSnapshot;
+}
+
+void ULocalLightingSubsystem::PlayBakedSequence(ULocalLightingSequenceBake* Bake, ULevelSequencePlayer* Player)
+{
+	BakedSequence = Bake;
+	BakedSequencePlayer = Player;
+	BakedKeyIndex = INDEX_NONE;
+}
+
+void ULocalLightingSubsystem::StopBakedSequence()
+{
+	// Volumes keep their baked state until the next evaluation tests containment again.
+	BakedSequence = nullptr;
+	BakedSequencePlayer.Reset();
+	BakedKeyIndex = INDEX_NONE;
+}
+
+bool ULocalLightingSubsystem::IsPlayingBakedSequence() const
+{
+	return BakedSequence != nullptr;
+}
+
+FLocalLightingViewPointProvider ULocalLightingSubsystem::MakePlayerCameraViewPointProvider(UWorld* World, int32 PlayerIndex)
+{
+	return FLocalLightingViewPointProvider::CreateLambda([WeakWorld = TWeakObjectPtr<UWorld>(World), PlayerIndex](FVector& OutViewPoint)
+	{
+		if (APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(WeakWorld.Get(), PlayerIndex))
+		{
+			OutViewPoint = CameraManager->GetCameraLocation();
+			return true;
+		}
+		return false;
+	});
+}
+
+FLocalLightingViewPointProvider ULocalLightingSubsystem::MakePlayerPawnViewPointProvider(UWorld* World, int32 PlayerIndex)
+{
+	return FLocalLightingViewPointProvider::CreateLambda([WeakWorld = TWeakObjectPtr<UWorld>(World), PlayerIndex](FVector& OutViewPoint)
+	{
+		if (APawn* Pawn = UGameplayStatics::GetPlayerPawn(WeakWorld.Get(), PlayerIndex))
+		{
+			OutViewPoint = Pawn->GetActorLocation();
+			return true;
+		}
+		return false;
+	});
+}
+
+FLocalLightingViewPointProvider ULocalLightingSubsystem::MakeComponentViewPointProvider(USceneComponent* Component)
+{
+	return FLocalLightingViewPointProvider::CreateLambda([WeakComponent = TWeakObjectPtr<USceneComponent>(Component)](FVector& OutViewPoint)
+	{
+		if (USceneComponent* SceneComponent = WeakComponent.Get())
+		{
+			OutViewPoint = SceneComponent->GetComponentLocation();
+			return true;
+		}
+		return false;
+	});
+}
+
+void ULocalLightingSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	// Apply the registrations queued during the previous frame, e.g. by streamed in Levels, in one batch.
+	if (World == GetWorld())
+	{
+		FlushPendingVolumes();
+
+		// Every View of the frame resolves its overrides the same way.
+		const bool bWasPerViewOverrides = bPerViewOverrides;
+		bPerViewOverrides = IsPerViewOverridesEnabled();
+
+		// The light components are left untouched per View, put them back on the lighting of no Volume once.
+		if (bPerViewOverrides && !bWasPerViewOverrides)
+		{
+			for (int32 DenseIndex = Volumes.Num() - 1; DenseIndex >= 0; DenseIndex--)
+			{
+				IInterface_LocalLightingVolume* Volume = Volumes[DenseIndex].Get();
+				if (Volume && (Volume->IsOverridingLighting() || Volume->IsViewPointInVolume()))
+				{
+					Volume->ForceExit();
+				}
+			}
+		}
+	}
+}
+
+void ULocalLightingSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	// Broadcast after every Actor ticked and the player cameras are updated, but before the end of frame updates
+	// send the render state, so that the changes made here are rendered in the same frame.
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	const double CurrentTime = World->GetRealTimeSeconds();
+	if (bPerViewOverrides)
+	{
+		// Only the View overrides are resolved, per View by the View extension, no light component is evaluated.
+	}
+	else if (IsPlayingBakedSequence())
+	{
+		EvaluateBakedSequence();
+	}
+	else if (ViewPointProvider.IsBound())
+	{
+		const float EvaluationRate = CVarLocalLightingVolumeEvaluationRate.GetValueOnGameThread();
+		if (EvaluationRate <= 0.0f || CurrentTime - LastEvaluationTime >= 1.0 / EvaluationRate)
+		{
+			FVector ViewPoint;
+			if (ViewPointProvider.Execute(ViewPoint))
+			{
+				LastEvaluationTime = CurrentTime;
+				ProcessVolume(ViewPoint);
+			}
+		}
+	}
+
+	Transitions.Tick(DeltaSeconds);
+	UpdateSkyCaptures(CurrentTime);
+
+#if ENABLE_DRAW_DEBUG
+	if (FLocalLightingVolumeDebugCounters::IsEnabled())
+	{
+		DrawDebugVolumes();
+	}
+#endif
+}
+
+#if ENABLE_DRAW_DEBUG
+void ULocalLightingSubsystem::DrawDebugVolumes()
+{
+	// Linked Volumes are not tested but still mutate their targets, draw them along with their parent.
+	TArray<ALocalLightingVolumeBase*, TInlineAllocator<64>> DebugVolumes;
+	for (const TWeakInterfacePtr<IInterface_LocalLightingVolume>& WeakVolume : Volumes)
+	{
+		if (ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(WeakVolume.GetObject()))
+		{
+			DebugVolumes.Add(Volume);
+			for (ALocalLightingVolumeBase* LinkedVolume : Volume->GetLinkedVolumes())
+			{
+				if (IsValid(LinkedVolume))
+				{
+					DebugVolumes.Add(LinkedVolume);
+				}
+			}
+		}
+	}
+
+	float MaxCost = 0.0f;
+	for (ALocalLightingVolumeBase* Volume : DebugVolumes)
+	{
+		MaxCost = FMath::Max(MaxCost, Volume->GetDebugCounters().GetCost());
+	}
+
+	const UWorld* World = GetWorld();
+	for (ALocalLightingVolumeBase* Volume : DebugVolumes)
+	{
+		FLocalLightingVolumeDebugCounters& Counters = Volume->GetDebugCounters();
+		const float Cost = Counters.GetCost();
+		const FColor Color = FLinearColor::LerpUsingHSV(FLinearColor::Green, FLinearColor::Red, MaxCost > 0.0f ? Cost / MaxCost : 0.0f).ToFColor(true);
+
+		// Candidates are the Volumes whose bounds contain the View Point, the ones testing their exact Shape.
+		const FBox Bounds = Volume->GetShapeBounds();
+		const bool bCandidate = Bounds.IsInsideOrOn(LastViewPoint);
+		DrawDebugBox(World, Bounds.GetCenter(), Bounds.GetExtent(), Color, false, -1.0f, SDPG_World, bCandidate ? 8.0f : 2.0f);
+		DrawDebugString(World, Bounds.GetCenter(), FString::Printf(TEXT("%s\nCost %.0f\nTests %u Transitions %u\nWrites %u Sky Recaptures %u"),
+			*Volume->GetActorNameOrLabel(), Cost,
+			Counters.GetTotal(ELocalLightingDebugEvent::Test), Counters.GetTotal(ELocalLightingDebugEvent::Transition),
+			Counters.GetTotal(ELocalLightingDebugEvent::Mutation), Counters.GetTotal(ELocalLightingDebugEvent::SkyRecapture)),
+			nullptr, Color, 0.0f, true);
+
+		// The instance bounds are the nodes filtering the candidate instances, highlight the ones around the View Point.
+		const ULocalLightingVolumeInstancesComponent* InstancesComponent = Volume->FindComponentByClass<ULocalLightingVolumeInstancesComponent>();
+		if (bCandidate && InstancesComponent)
+		{
+			for (const FBox& InstanceBounds : InstancesComponent->GetShapeInstances().GetInstanceBounds())
+			{
+				const bool bInstanceCandidate = InstanceBounds.IsInsideOrOn(LastViewPoint);
+				DrawDebugBox(World, InstanceBounds.GetCenter(), InstanceBounds.GetExtent(), bInstanceCandidate ? FColor::White : Color, false, -1.0f, SDPG_World, bInstanceCandidate ? 4.0f : 1.0f);
+			}
+		}
+	}
+}
+#endif
+
+void ULocalLightingSubsystem::EvaluateBakedSequence()
+{
+	const ULevelSequencePlayer* Player = BakedSequencePlayer.Get();
+	if (!Player)
+	{
+		StopBakedSequence();
+		return;
+	}
+
+	const int32 KeyIndex = BakedSequence->FindKey(Player->GetCurrentTime().AsSeconds());
+	if (KeyIndex == BakedKeyIndex)
+	{
+		return;
+	}
+	BakedKeyIndex = KeyIndex;
+
+	FlushPendingVolumes();
+
+	TSet<FSoftObjectPath> ActiveVolumes;
+	if (KeyIndex != INDEX_NONE)
+	{
+		ActiveVolumes.Append(BakedSequence->Keys[KeyIndex].ActiveVolumes);
+	}
+
+	TArray<bool, TInlineAllocator<64>> ActiveStates;
+	ActiveStates.SetNumZeroed(Volumes.Num());
+	if (ActiveVolumes.Num() > 0)
+	{
+		for (int32 DenseIndex = 0; DenseIndex < Volumes.Num(); DenseIndex++)
+		{
+			if (IInterface_LocalLightingVolume* Volume = Volumes[DenseIndex].Get())
+			{
+				ActiveStates[DenseIndex] = ActiveVolumes.Contains(GetSnapshotPath(Volume->_getUObject()));
+			}
+		}
+	}
+
+	// Exit first, in reverse order, so that the Volumes entered next cache the restored lighting.
+	for (int32 DenseIndex = Volumes.Num() - 1; DenseIndex >= 0; DenseIndex--)
+	{
+		IInterface_LocalLightingVolume* Volume = Volumes[DenseIndex].Get();
+		if (Volume && !ActiveStates[DenseIndex])
+		{
+			Volume->ForceExit();
+		}
+	}
+	for (int32 DenseIndex = 0; DenseIndex < Volumes.Num(); DenseIndex++)
+	{
+		IInterface_LocalLightingVolume* Volume = Volumes[DenseIndex].Get();
+		if (Volume && ActiveStates[DenseIndex])
+		{
+			Volume->ForceEnter();
+		}
+	}
+
+	// Never blend across a camera cut.
+	if (KeyIndex != INDEX_NONE && BakedSequence->Keys[KeyIndex].bCameraCut)
+	{
+		Transitions.Settle();
+	}
+}
+
+void ULocalLightingSubsystem::UpdateSkyCaptures(double CurrentTime)
+{
+	if (PendingSkyCaptures.Num() > 0 && CurrentTime - LastSkyCaptureTime >= CVarLocalLightingVolumeSkyCaptureMinInterval.GetValueOnGameThread())
+	{
+		LastSkyCaptureTime = CurrentTime;
+		FlushSkyCaptures();
+	}
+}
+
+void ULocalLightingSubsystem::OnConsoleVariablesChanged()
+{
+	// Sinks run after any console variable changed, only a change of the scalability groups matters here.
+	const Scalability::FQualityLevels NewQualityLevels = Scalability::GetQualityLevels();
+	if (NewQualityLevels == QualityLevels)
+	{
+		return;
+	}
+	QualityLevels = NewQualityLevels;
+
+	for (const TWeakInterfacePtr<IInterface_LocalLightingVolume>& WeakVolume : Volumes)
+	{
+		if (IInterface_LocalLightingVolume* Volume = WeakVolume.Get())
+		{
+			Volume->UpdateScalabilityVariant();
+		}
+	}
+}
+
+void ULocalLightingSubsystem::ResetVolumes()
+{
+	PendingOperations.Empty();
+	Transitions.Reset();
+	PendingSkyCaptures.Reset();
+	for (const TWeakInterfacePtr<IInterface_LocalLightingVolume>& WeakVolume : Volumes)
+	{
+		if (IInterface_LocalLightingVolume* Volume = WeakVolume.Get())
+		{
+			Volume->SetSubsystemHandle(FLocalLightingVolumeHandle());
+		}
+	}
+	Slots.Reset();
+	FreeSlots.Reset();
+	Volumes.Reset();
+	VolumeSlots.Reset();
+	CandidateFilter.Reset();
+#if WITH_EDITORONLY_DATA
+	VolumePackages.Reset();
+	VolumePackageIndices.Reset();
+	PackageVolumes.Reset();
+#endif
+}
+
+#if WITH_EDITOR
+void ULocalLightingSubsystem::OnPackagePreSave(UPackage* Package, FObjectPreSaveContext Context)
+{
+	FlushPendingVolumes();
+
+	// We can assert that the Volumes and the light components they override are all in the same UWorld package.
+	if (const TArray<FLocalLightingVolumeHandle>* Handles = PackageVolumes.Find(Package))
+	{
+		// We can not be overriding any light component when they are saved.
+		// Restore in reverse order of entering so that nested Volumes unwind back to the original values.
+		TArray<ALocalLightingVolumeBase*, TInlineAllocator<64>> PackageVolumesToRestore;
+		for (const FLocalLightingVolumeHandle& Handle : *Handles)
+		{
+			if (ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(Volumes[Slots[Handle.Index].DenseIndex].GetObject()))
+			{
+				PackageVolumesToRestore.Add(Volume);
+			}
+		}
+		PackageVolumesToRestore.Sort([](const ALocalLightingVolumeBase& A, const ALocalLightingVolumeBase& B)
+		{
+			return A.GetEnterOrder() > B.GetEnterOrder();
+		});
+		for (ALocalLightingVolumeBase* Volume : PackageVolumesToRestore)
+		{
+			Volume->OnOwningPackagePreSave();
+		}
+
+		// Restored values blending back must land before the package is serialized.
+		Transitions.Settle();
+		FlushSkyCaptures();
+	}
+}
+
+void ULocalLightingSubsystem::OnPackageSaved(const FString& FileName, UPackage* Package, FObjectPostSaveContext Context)
+{
+	if (const TArray<FLocalLightingVolumeHandle>* Handles = PackageVolumes.Find(Package))
+	{
+		for (const FLocalLightingVolumeHandle& Handle : *Handles)
 		{
-			if (*It == Volume)
+			if (IInterface_LocalLightingVolume* Volume = Volumes[Slots[Handle.Index].DenseIndex].Get())
 			{
-				It.RemoveCurrent();
+				Volume->OnOwningPackageSaved();
 			}
 		}
 	}
 }
+#endif
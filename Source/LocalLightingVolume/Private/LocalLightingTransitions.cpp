@@ -0,0 +1,392 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingTransitions.h"
+
+// Engine Include
+#include "Components/LightComponent.h"
+#include "Components/LightComponentBase.h"
+#include "Components/SkyLightComponent.h"
+#include "HAL/IConsoleManager.h"
+
+// Plugins Include
+#include "LocalLightingVolume.h"
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeTransitionUpdateRate(
+	TEXT("r.LocalLightingVolume.Transition.UpdateRate"),
+	30.0f,
+	TEXT("Maximum rate in Hz at which a blended transition updates its light component.\n")
+	TEXT("0 updates every World tick."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeTransitionThreshold(
+	TEXT("r.LocalLightingVolume.Transition.Threshold"),
+	0.01f,
+	TEXT("Fraction of the whole transition under which an update is considered imperceptible and skipped.\n")
+	TEXT("0.01 splits a transition in at most 100 steps."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarLocalLightingVolumeTransitionRotationSteps(
+	TEXT("r.LocalLightingVolume.Transition.RotationSteps"),
+	0,
+	TEXT("Number of discrete transform updates a rotation transition is split in, each one invalidating the cached shadows of the light.\n")
+	TEXT("0 updates the rotation at r.LocalLightingVolume.Transition.UpdateRate."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeTransitionRotationAngleStep(
+	TEXT("r.LocalLightingVolume.Transition.RotationAngleStep"),
+	0.0f,
+	TEXT("Angular step in degrees the intermediate rotations of a transition are snapped to, the last update always writes the exact target.\n")
+	TEXT("0 disables snapping."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeTransitionRotationMinAngle(
+	TEXT("r.LocalLightingVolume.Transition.RotationMinAngle"),
+	0.0f,
+	TEXT("Angle in degrees under which an intermediate rotation update is skipped.\n")
+	TEXT("0 only applies r.LocalLightingVolume.Transition.Threshold."),
+	ECVF_Default);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rotation Transitions"), STAT_LocalLightingVolume_RotationTransitions, STATGROUP_LocalLightingVolume);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rotation Transform Updates"), STAT_LocalLightingVolume_RotationUpdates, STATGROUP_LocalLightingVolume);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Last Rotation Updates per Transition"), STAT_LocalLightingVolume_LastRotationUpdatesPerTransition, STATGROUP_LocalLightingVolume);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Max Rotation Updates per Transition"), STAT_LocalLightingVolume_MaxRotationUpdatesPerTransition, STATGROUP_LocalLightingVolume);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Average Rotation Updates per Transition"), STAT_LocalLightingVolume_AverageRotationUpdatesPerTransition, STATGROUP_LocalLightingVolume);
+
+static FVector4 InterpolateValue(ELocalLightingBlendProperty Property, const FVector4& From, const FVector4& To, float Alpha)
+{
+	if (Property == ELocalLightingBlendProperty::Rotation)
+	{
+		const FQuat Quat = FQuat::Slerp(FQuat(From.X, From.Y, From.Z, From.W), FQuat(To.X, To.Y, To.Z, To.W), Alpha);
+		return FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+	}
+	return FMath::Lerp(From, To, Alpha);
+}
+
+/** Intermediate rotation of a transition, limited by the rotation CVars so that the light transform changes as rarely as possible. */
+static bool GetSteppedRotation(const FVector4& From, const FVector4& To, float Alpha, const FVector4& LastValue, FVector4& OutValue)
+{
+	const int32 RotationSteps = CVarLocalLightingVolumeTransitionRotationSteps.GetValueOnGameThread();
+	if (RotationSteps > 0)
+	{
+		Alpha = FMath::FloorToFloat(Alpha * RotationSteps) / RotationSteps;
+	}
+
+	FQuat Quat = FQuat::Slerp(FQuat(From.X, From.Y, From.Z, From.W), FQuat(To.X, To.Y, To.Z, To.W), Alpha);
+	const float AngleStep = CVarLocalLightingVolumeTransitionRotationAngleStep.GetValueOnGameThread();
+	if (AngleStep > 0.0f)
+	{
+		Quat = Quat.Rotator().GridSnap(FRotator(AngleStep)).Quaternion();
+	}
+
+	const FQuat LastQuat(LastValue.X, LastValue.Y, LastValue.Z, LastValue.W);
+	const float MinAngle = CVarLocalLightingVolumeTransitionRotationMinAngle.GetValueOnGameThread();
+	if (Quat.Equals(LastQuat, UE_KINDA_SMALL_NUMBER) || FMath::RadiansToDegrees(Quat.AngularDistance(LastQuat)) < MinAngle)
+	{
+		return false;
+	}
+
+	OutValue = FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+	return true;
+}
+
+static float GetMaxDifference(const FVector4& A, const FVector4& B)
+{
+	return FMath::Max(FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y)), FMath::Max(FMath::Abs(A.Z - B.Z), FMath::Abs(A.W - B.W)));
+}
+
+void FLocalLightingTransitions::SetValue(ULightComponentBase* Component, ELocalLightingBlendProperty Property, const FVector4& Value, float Duration)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	const int32 Index = FindTransition(Component, Property);
+	if (Duration <= 0.0f)
+	{
+		int32 NumUpdates = 0;
+		if (Index != INDEX_NONE)
+		{
+			NumUpdates = Transitions[Index].NumUpdates;
+			Transitions.RemoveAtSwap(Index);
+		}
+		if (ReadValue(Component, Property) != Value)
+		{
+			if (Property == ELocalLightingBlendProperty::Rotation && Index == INDEX_NONE)
+			{
+				INC_DWORD_STAT(STAT_LocalLightingVolume_RotationTransitions);
+			}
+			WriteValue(Component, Property, Value);
+			NumUpdates++;
+		}
+		if (NumUpdates > 0 || Index != INDEX_NONE)
+		{
+			OnTransitionEnded(Property, NumUpdates);
+		}
+		return;
+	}
+
+	// Start from the value currently displayed, so that retargeting a running transition does not pop.
+	const FVector4 CurrentValue = ReadValue(Component, Property);
+	if (CurrentValue == Value)
+	{
+		if (Index != INDEX_NONE)
+		{
+			OnTransitionEnded(Property, Transitions[Index].NumUpdates);
+			Transitions.RemoveAtSwap(Index);
+		}
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+	if (Property == ELocalLightingBlendProperty::Rotation && Index == INDEX_NONE)
+	{
+		INC_DWORD_STAT(STAT_LocalLightingVolume_RotationTransitions);
+	}
+	FTransition& Transition = Index != INDEX_NONE ? Transitions[Index] : Transitions.AddDefaulted_GetRef();
+	Transition.Component = Component;
+	Transition.Property = Property;
+	Transition.From = CurrentValue;
+	Transition.To = Value;
+	Transition.LastValue = CurrentValue;
+	Transition.Duration = Duration;
+	Transition.Elapsed = 0.0f;
+}
+
+FVector4 FLocalLightingTransitions::GetSettledValue(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const
+{
+	const int32 Index = FindTransition(Component, Property);
+	return Index != INDEX_NONE ? Transitions[Index].To : ReadValue(Component, Property);
+}
+
+void FLocalLightingTransitions::Tick(float DeltaSeconds)
+{
+	const float UpdateRate = CVarLocalLightingVolumeTransitionUpdateRate.GetValueOnGameThread();
+	const float Threshold = CVarLocalLightingVolumeTransitionThreshold.GetValueOnGameThread();
+
+	for (int32 Index = Transitions.Num() - 1; Index >= 0; Index--)
+	{
+		FTransition& Transition = Transitions[Index];
+		ULightComponentBase* Component = Transition.Component.Get();
+		if (!Component)
+		{
+			Transitions.RemoveAtSwap(Index);
+			continue;
+		}
+
+		Transition.Elapsed += DeltaSeconds;
+		Transition.TimeSinceUpdate += DeltaSeconds;
+		if (Transition.Elapsed >= Transition.Duration)
+		{
+			if (Transition.LastValue != Transition.To)
+			{
+				WriteValue(Component, Transition.Property, Transition.To);
+				Transition.NumUpdates++;
+			}
+			OnTransitionEnded(Transition.Property, Transition.NumUpdates);
+			Transitions.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (UpdateRate > 0.0f && Transition.TimeSinceUpdate < 1.0f / UpdateRate)
+		{
+			continue;
+		}
+
+		const float Alpha = FMath::SmoothStep(0.0f, 1.0f, Transition.Elapsed / Transition.Duration);
+		FVector4 Value = InterpolateValue(Transition.Property, Transition.From, Transition.To, Alpha);
+		if (GetMaxDifference(Value, Transition.LastValue) <= Threshold * GetMaxDifference(Transition.To, Transition.From))
+		{
+			continue;
+		}
+		// Every transform update of a light invalidates its cached shadows, e.g. the whole Virtual Shadow Map cache of the sun.
+		if (Transition.Property == ELocalLightingBlendProperty::Rotation && !GetSteppedRotation(Transition.From, Transition.To, Alpha, Transition.LastValue, Value))
+		{
+			continue;
+		}
+
+		WriteValue(Component, Transition.Property, Value);
+		Transition.NumUpdates++;
+		Transition.LastValue = Value;
+		Transition.TimeSinceUpdate = 0.0f;
+	}
+}
+
+void FLocalLightingTransitions::Settle()
+{
+	for (FTransition& Transition : Transitions)
+	{
+		if (ULightComponentBase* Component = Transition.Component.Get())
+		{
+			WriteValue(Component, Transition.Property, Transition.To);
+			Transition.NumUpdates++;
+			OnTransitionEnded(Transition.Property, Transition.NumUpdates);
+		}
+	}
+	Transitions.Reset();
+}
+
+void FLocalLightingTransitions::Settle(const ULightComponentBase* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	for (int32 Index = Transitions.Num() - 1; Index >= 0; Index--)
+	{
+		FTransition& Transition = Transitions[Index];
+		if (Transition.Component.Get() == Component)
+		{
+			WriteValue(Transition.Component.Get(), Transition.Property, Transition.To);
+			Transition.NumUpdates++;
+			OnTransitionEnded(Transition.Property, Transition.NumUpdates);
+			Transitions.RemoveAtSwap(Index);
+		}
+	}
+}
+
+void FLocalLightingTransitions::Reset()
+{
+	Transitions.Reset();
+}
+
+int32 FLocalLightingTransitions::Num() const
+{
+	return Transitions.Num();
+}
+
+SIZE_T FLocalLightingTransitions::GetAllocatedSize() const
+{
+	return Transitions.GetAllocatedSize();
+}
+
+int32 FLocalLightingTransitions::GetNumEndedRotationTransitions() const
+{
+	return NumEndedRotationTransitions;
+}
+
+int32 FLocalLightingTransitions::GetLastRotationUpdatesPerTransition() const
+{
+	return LastRotationUpdatesPerTransition;
+}
+
+int32 FLocalLightingTransitions::GetMaxRotationUpdatesPerTransition() const
+{
+	return MaxRotationUpdatesPerTransition;
+}
+
+float FLocalLightingTransitions::GetAverageRotationUpdatesPerTransition() const
+{
+	return NumEndedRotationTransitions > 0 ? (float)((double)NumEndedRotationUpdates / NumEndedRotationTransitions) : 0.0f;
+}
+
+FVector4 FLocalLightingTransitions::ReadValue(const ULightComponentBase* Component, ELocalLightingBlendProperty Property)
+{
+	switch (Property)
+	{
+	case ELocalLightingBlendProperty::Intensity:
+		return FVector4(Component->Intensity, 0.0f, 0.0f, 0.0f);
+	case ELocalLightingBlendProperty::LightColor:
+		return FVector4(Component->GetLightColor());
+	case ELocalLightingBlendProperty::IndirectLightingIntensity:
+		return FVector4(Component->IndirectLightingIntensity, 0.0f, 0.0f, 0.0f);
+	case ELocalLightingBlendProperty::VolumetricScatteringIntensity:
+		return FVector4(Component->VolumetricScatteringIntensity, 0.0f, 0.0f, 0.0f);
+	case ELocalLightingBlendProperty::Rotation:
+		{
+			const FQuat Quat = Component->GetComponentQuat();
+			return FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+		}
+	default:
+		return FVector4(0.0f);
+	}
+}
+
+void FLocalLightingTransitions::WriteValue(ULightComponentBase* Component, ELocalLightingBlendProperty Property, const FVector4& Value)
+{
+	// The setters are declared separately by the light and sky light components, not by their common base.
+	ULightComponent* LightComponent = Cast<ULightComponent>(Component);
+	USkyLightComponent* SkyLightComponent = Cast<USkyLightComponent>(Component);
+	switch (Property)
+	{
+	case ELocalLightingBlendProperty::Intensity:
+		if (LightComponent)
+		{
+			LightComponent->SetIntensity(Value.X);
+		}
+		else if (SkyLightComponent)
+		{
+			SkyLightComponent->SetIntensity(Value.X);
+		}
+		break;
+	case ELocalLightingBlendProperty::LightColor:
+		if (LightComponent)
+		{
+			LightComponent->SetLightColor(FLinearColor(Value.X, Value.Y, Value.Z, Value.W));
+		}
+		else if (SkyLightComponent)
+		{
+			SkyLightComponent->SetLightColor(FLinearColor(Value.X, Value.Y, Value.Z, Value.W));
+		}
+		break;
+	case ELocalLightingBlendProperty::IndirectLightingIntensity:
+		if (LightComponent)
+		{
+			LightComponent->SetIndirectLightingIntensity(Value.X);
+		}
+		else if (SkyLightComponent)
+		{
+			SkyLightComponent->SetIndirectLightingIntensity(Value.X);
+		}
+		break;
+	case ELocalLightingBlendProperty::VolumetricScatteringIntensity:
+		if (LightComponent)
+		{
+			LightComponent->SetVolumetricScatteringIntensity(Value.X);
+		}
+		else if (SkyLightComponent)
+		{
+			SkyLightComponent->SetVolumetricScatteringIntensity(Value.X);
+		}
+		break;
+	case ELocalLightingBlendProperty::Rotation:
+		INC_DWORD_STAT(STAT_LocalLightingVolume_RotationUpdates);
+		Component->SetWorldRotation(FQuat(Value.X, Value.Y, Value.Z, Value.W));
+		break;
+	default:
+		break;
+	}
+}
+
+int32 FLocalLightingTransitions::FindTransition(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const
+{
+	return Transitions.IndexOfByPredicate([Component, Property](const FTransition& Transition)
+	{
+		return Transition.Property == Property && Transition.Component.Get() == Component;
+	});
+}
+
+void FLocalLightingTransitions::OnTransitionEnded(ELocalLightingBlendProperty Property, int32 NumUpdates)
+{
+	// Only rotations are tracked, every update of a light transform invalidating its cached shadows.
+	if (Property != ELocalLightingBlendProperty::Rotation)
+	{
+		return;
+	}
+
+	NumEndedRotationTransitions++;
+	NumEndedRotationUpdates += NumUpdates;
+	LastRotationUpdatesPerTransition = NumUpdates;
+	MaxRotationUpdatesPerTransition = FMath::Max(MaxRotationUpdatesPerTransition, NumUpdates);
+
+	SET_DWORD_STAT(STAT_LocalLightingVolume_LastRotationUpdatesPerTransition, LastRotationUpdatesPerTransition);
+	SET_DWORD_STAT(STAT_LocalLightingVolume_MaxRotationUpdatesPerTransition, MaxRotationUpdatesPerTransition);
+	SET_FLOAT_STAT(STAT_LocalLightingVolume_AverageRotationUpdatesPerTransition, GetAverageRotationUpdatesPerTransition());
+}
@@ -10,6 +10,10 @@
 
 #define LOCTEXT_NAMESPACE "FLocalLightingVolumeModule"
 
+DEFINE_LOG_CATEGORY(LogLocalLightingVolume);
+
+LLM_DEFINE_TAG(LocalLightingVolume);
+
 void FLocalLightingVolumeModule::StartupModule()
 {
 
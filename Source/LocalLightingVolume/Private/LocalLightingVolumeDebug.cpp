@@ -0,0 +1,77 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingVolumeDebug.h"
+
+// Engine Include
+#include "HAL/IConsoleManager.h"
+
+#if ENABLE_DRAW_DEBUG
+static TAutoConsoleVariable<int32> CVarLocalLightingVolumeDebug(
+	TEXT("r.LocalLightingVolume.Debug"),
+	0,
+	TEXT("Draw every registered Local Lighting Volume colored by its cost over r.LocalLightingVolume.Debug.Window, from green to red.\n")
+	TEXT("Volumes encompassing the View Point are drawn thicker along with the bounds of their instances."),
+	ECVF_Cheat);
+
+static TAutoConsoleVariable<float> CVarLocalLightingVolumeDebugWindow(
+	TEXT("r.LocalLightingVolume.Debug.Window"),
+	4.0f,
+	TEXT("Length in seconds of the sliding window the debug counters of the Volumes are summed over."),
+	ECVF_Cheat);
+
+/** Rough relative cost of each event: a test is a few transforms, a mutation dirties render state, a recapture renders the sky. */
+static constexpr float DebugEventCosts[static_cast<int32>(ELocalLightingDebugEvent::Num)] = { 1.0f, 10.0f, 25.0f, 500.0f };
+
+bool FLocalLightingVolumeDebugCounters::IsEnabled()
+{
+	return CVarLocalLightingVolumeDebug.GetValueOnGameThread() != 0;
+}
+
+void FLocalLightingVolumeDebugCounters::Add(ELocalLightingDebugEvent Event, uint32 Count)
+{
+	Advance();
+	Counts[static_cast<int32>(Event)][CurrentBucket % NumBuckets] += Count;
+}
+
+uint32 FLocalLightingVolumeDebugCounters::GetTotal(ELocalLightingDebugEvent Event)
+{
+	Advance();
+	uint32 Total = 0;
+	for (const uint32 Count : Counts[static_cast<int32>(Event)])
+	{
+		Total += Count;
+	}
+	return Total;
+}
+
+float FLocalLightingVolumeDebugCounters::GetCost()
+{
+	float Cost = 0.0f;
+	for (int32 Event = 0; Event < static_cast<int32>(ELocalLightingDebugEvent::Num); Event++)
+	{
+		Cost += DebugEventCosts[Event] * GetTotal(static_cast<ELocalLightingDebugEvent>(Event));
+	}
+	return Cost;
+}
+
+void FLocalLightingVolumeDebugCounters::Advance()
+{
+	const double BucketDuration = FMath::Max(CVarLocalLightingVolumeDebugWindow.GetValueOnGameThread(), 0.1f) / NumBuckets;
+	const int64 Bucket = FMath::FloorToInt64(FPlatformTime::Seconds() / BucketDuration);
+	const int64 NumExpiredBuckets = FMath::Min<int64>(Bucket - CurrentBucket, NumBuckets);
+	for (int64 Index = 1; Index <= NumExpiredBuckets; Index++)
+	{
+		for (uint32 (&EventCounts)[NumBuckets] : Counts)
+		{
+			EventCounts[(CurrentBucket + Index) % NumBuckets] = 0;
+		}
+	}
+	CurrentBucket = FMath::Max(CurrentBucket, Bucket);
+}
+#endif
@@ -0,0 +1,154 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingVolumeInstancesComponent.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+#include "LocalLightingVolume.h"
+
+ULocalLightingVolumeInstancesComponent::ULocalLightingVolumeInstancesComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	ShapeExtent = FVector(100.0f);
+}
+
+int32 ULocalLightingVolumeInstancesComponent::AddInstances(const TArray<FTransform>& Transforms)
+{
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+	const int32 FirstIndex = InstanceTransforms.Num();
+	InstanceTransforms.Append(Transforms);
+
+	TArray<FTransform> InstanceToWorlds;
+	InstanceToWorlds.Reserve(Transforms.Num());
+	for (const FTransform& Transform : Transforms)
+	{
+		InstanceToWorlds.Add(Transform * GetComponentTransform());
+	}
+	ShapeInstances.Add(InstanceToWorlds, ShapeExtent);
+	UpdateOwnerBounds();
+	return FirstIndex;
+}
+
+void ULocalLightingVolumeInstancesComponent::RemoveInstances(const TArray<int32>& Indices)
+{
+	TArray<int32> SortedIndices = Indices;
+	SortedIndices.Sort(TGreater<int32>());
+	int32 LastRemovedIndex = INDEX_NONE;
+	for (const int32 Index : SortedIndices)
+	{
+		if (Index != LastRemovedIndex && InstanceTransforms.IsValidIndex(Index))
+		{
+			InstanceTransforms.RemoveAt(Index);
+			LastRemovedIndex = Index;
+		}
+	}
+	RebuildInstances();
+}
+
+void ULocalLightingVolumeInstancesComponent::ClearInstances()
+{
+	InstanceTransforms.Reset();
+	RebuildInstances();
+}
+
+bool ULocalLightingVolumeInstancesComponent::UpdateInstanceTransform(int32 Index, const FTransform& Transform)
+{
+	if (!InstanceTransforms.IsValidIndex(Index))
+	{
+		return false;
+	}
+	InstanceTransforms[Index] = Transform;
+	RebuildInstances();
+	return true;
+}
+
+int32 ULocalLightingVolumeInstancesComponent::GetInstanceCount() const
+{
+	return InstanceTransforms.Num();
+}
+
+const TArray<FTransform>& ULocalLightingVolumeInstancesComponent::GetInstanceTransforms() const
+{
+	return InstanceTransforms;
+}
+
+const FBox& ULocalLightingVolumeInstancesComponent::GetInstancesBounds() const
+{
+	return ShapeInstances.GetBounds();
+}
+
+const FLocalLightingShapeInstances& ULocalLightingVolumeInstancesComponent::GetShapeInstances() const
+{
+	return ShapeInstances;
+}
+
+void ULocalLightingVolumeInstancesComponent::SetShapeExtent(const FVector& Extent)
+{
+	if (ShapeExtent != Extent)
+	{
+		ShapeExtent = Extent;
+		RebuildInstances();
+	}
+}
+
+void ULocalLightingVolumeInstancesComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	RebuildInstances();
+}
+
+void ULocalLightingVolumeInstancesComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(InstanceTransforms.GetAllocatedSize() + ShapeInstances.GetAllocatedSize());
+}
+
+#if WITH_EDITOR
+void ULocalLightingVolumeInstancesComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(ULocalLightingVolumeInstancesComponent, InstanceTransforms))
+	{
+		RebuildInstances();
+	}
+}
+#endif
+
+void ULocalLightingVolumeInstancesComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	RebuildInstances();
+}
+
+void ULocalLightingVolumeInstancesComponent::RebuildInstances()
+{
+	LLM_SCOPE_BYTAG(LocalLightingVolume);
+
+	TArray<FTransform> InstanceToWorlds;
+	InstanceToWorlds.Reserve(InstanceTransforms.Num());
+	for (const FTransform& Transform : InstanceTransforms)
+	{
+		InstanceToWorlds.Add(Transform * GetComponentTransform());
+	}
+	ShapeInstances.Rebuild(InstanceToWorlds, ShapeExtent);
+	UpdateOwnerBounds();
+}
+
+void ULocalLightingVolumeInstancesComponent::UpdateOwnerBounds()
+{
+	if (ALocalLightingVolumeBase* Volume = Cast<ALocalLightingVolumeBase>(GetOwner()))
+	{
+		Volume->UpdateSubsystemBounds();
+	}
+}
@@ -0,0 +1,486 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingVolumeLayoutCommandlet.h"
+
+// Engine Include
+#include "AI/NavigationSystemBase.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "NavigationPath.h"
+#include "NavigationSystem.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+#include "LocalLightingCandidateFilter.h"
+#include "LocalLightingOverrideDiff.h"
+#include "LocalLightingVolume.h"
+
+/** Upper bound of the spatial cells, the cell size grows to stay under it. */
+static constexpr int64 MaxLayoutCells = 65536;
+
+static UWorld* LoadLayoutWorld(const FString& MapName)
+{
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	World->WorldType = EWorldType::Editor;
+	World->AddToRoot();
+	if (!World->bIsWorldInitialized)
+	{
+		// Brush Volumes test containment against their physics body, and paths are sampled on the navigation mesh.
+		UWorld::InitializationValues InitializationValues;
+		InitializationValues.RequiresHitProxies(false)
+			.ShouldSimulatePhysics(false)
+			.EnableTraceCollision(false)
+			.CreatePhysicsScene(true)
+			.CreateNavigation(true)
+			.CreateAISystem(false)
+			.AllowAudioPlayback(false);
+		World->InitWorld(InitializationValues);
+	}
+	World->UpdateWorldComponents(true, false);
+	FNavigationSystem::AddNavigationSystemToWorld(*World, FNavigationSystemRunMode::EditorMode);
+	return World;
+}
+
+static void UnloadLayoutWorld(UWorld* World)
+{
+	World->ClearWorldComponents();
+	World->CleanupWorld();
+	World->RemoveFromRoot();
+}
+
+static void SampleNavigationPaths(UWorld* World, int32 PathCount, float SampleSpacing, float EyeHeight, TArray<FVector>& OutViewPoints)
+{
+	UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (!NavigationSystem || !NavigationSystem->GetDefaultNavDataInstance(FNavigationSystem::DontCreate))
+	{
+		return;
+	}
+
+	for (int32 PathIndex = 0; PathIndex < PathCount; PathIndex++)
+	{
+		FNavLocation Start;
+		FNavLocation End;
+		if (!NavigationSystem->GetRandomPoint(Start) || !NavigationSystem->GetRandomPoint(End))
+		{
+			continue;
+		}
+
+		const UNavigationPath* Path = UNavigationSystemV1::FindPathToLocationSynchronously(World, Start.Location, End.Location);
+		if (!Path || !Path->IsValid())
+		{
+			continue;
+		}
+
+		for (int32 PointIndex = 1; PointIndex < Path->PathPoints.Num(); PointIndex++)
+		{
+			const FVector SegmentStart = Path->PathPoints[PointIndex - 1];
+			const FVector SegmentEnd = Path->PathPoints[PointIndex];
+			const int32 NumSamples = FMath::Max(FMath::CeilToInt(FVector::Dist(SegmentStart, SegmentEnd) / SampleSpacing), 1);
+			for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+			{
+				OutViewPoints.Add(FMath::Lerp(SegmentStart, SegmentEnd, float(SampleIndex) / NumSamples) + FVector(0.0f, 0.0f, EyeHeight));
+			}
+		}
+	}
+}
+
+/** Whether every override of the Volume equals the value it would override, so that entering it changes nothing. */
+static bool IsNoOpVolume(const ALocalLightingVolumeBase* Volume, const TMap<FName, FString>& Payload)
+{
+	const AActor* Target = Volume->GetOverrideTarget();
+	for (const TPair<FName, FString>& Pair : Payload)
+	{
+		bool bEqual = false;
+		if (Target)
+		{
+			// Overrides are named after the property of the component they override.
+			for (const UActorComponent* Component : Target->GetComponents())
+			{
+				if (const FProperty* Property = Component ? Component->GetClass()->FindPropertyByName(Pair.Key) : nullptr)
+				{
+					FString Value;
+					Property->ExportTextItem_InContainer(Value, Component, nullptr, nullptr, PPF_None);
+					bEqual = Value == Pair.Value;
+					break;
+				}
+			}
+		}
+		else if (const IConsoleVariable* Variable = IConsoleManager::Get().FindConsoleVariable(*Pair.Key.ToString()))
+		{
+			bEqual = Variable->GetString() == Pair.Value;
+		}
+
+		if (!bEqual)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#if WITH_EDITOR
+/** Merge every cluster of touching Volumes sharing the same overrides into its first Volume, returns the number of Volumes destroyed. */
+static int32 MergeRedundantVolumes(UWorld* World, const TArray<ALocalLightingVolumeBase*>& Volumes, const TArray<FBox>& VolumeBounds, float Tolerance)
+{
+	TArray<int32> Clusters;
+	Clusters.SetNumUninitialized(Volumes.Num());
+	for (int32 Index = 0; Index < Volumes.Num(); Index++)
+	{
+		Clusters[Index] = Index;
+	}
+	auto FindCluster = [&Clusters](int32 Index)
+	{
+		while (Clusters[Index] != Index)
+		{
+			Clusters[Index] = Clusters[Clusters[Index]];
+			Index = Clusters[Index];
+		}
+		return Index;
+	};
+
+	for (int32 IndexA = 0; IndexA < Volumes.Num(); IndexA++)
+	{
+		const FBox Bounds = VolumeBounds[IndexA].ExpandBy(Tolerance);
+		for (int32 IndexB = IndexA + 1; IndexB < Volumes.Num(); IndexB++)
+		{
+			if (Bounds.Intersect(VolumeBounds[IndexB]) && Volumes[IndexA]->CanMergeWith(Volumes[IndexB]))
+			{
+				const int32 ClusterA = FindCluster(IndexA);
+				const int32 ClusterB = FindCluster(IndexB);
+				Clusters[FMath::Max(ClusterA, ClusterB)] = FMath::Min(ClusterA, ClusterB);
+			}
+		}
+	}
+
+	int32 NumMerged = 0;
+	for (int32 Index = 0; Index < Volumes.Num(); Index++)
+	{
+		ALocalLightingVolumeBase* Target = Volumes[FindCluster(Index)];
+		if (Target != Volumes[Index] && Target->MergeVolume(Volumes[Index]))
+		{
+			UE_LOG(LogLocalLightingVolume, Display, TEXT("Merged %s into %s."), *Volumes[Index]->GetActorNameOrLabel(), *Target->GetActorNameOrLabel());
+			World->EditorDestroyActor(Volumes[Index], true);
+			NumMerged++;
+		}
+	}
+	return NumMerged;
+}
+#endif
+
+ULocalLightingVolumeLayoutCommandlet::ULocalLightingVolumeLayoutCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	HelpDescription = TEXT("Report the layout of the Local Lighting Volumes of a map.");
+	HelpUsage = TEXT("-run=LocalLightingVolumeLayout -Map=/Game/Maps/MyMap [-CellSize=1000] [-PathCount=32] [-SampleSpacing=200] [-EyeHeight=160] [-Seed=0] [-MaxOverlapDepth=N] [-MaxCellCandidates=N] [-FailOnConflicts] [-FailOnNoOp] [-Merge [-MergeTolerance=1] [-Save]]");
+}
+
+int32 ULocalLightingVolumeLayoutCommandlet::Main(const FString& Params)
+{
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogLocalLightingVolume, Error, TEXT("Usage: %s"), *HelpUsage);
+		return 1;
+	}
+
+	float CellSize = 1000.0f;
+	int32 PathCount = 32;
+	float SampleSpacing = 200.0f;
+	float EyeHeight = 160.0f;
+	int32 Seed = 0;
+	int32 MaxOverlapDepth = INT32_MAX;
+	int32 MaxCellCandidates = INT32_MAX;
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+	FParse::Value(*Params, TEXT("PathCount="), PathCount);
+	FParse::Value(*Params, TEXT("SampleSpacing="), SampleSpacing);
+	FParse::Value(*Params, TEXT("EyeHeight="), EyeHeight);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("MaxOverlapDepth="), MaxOverlapDepth);
+	FParse::Value(*Params, TEXT("MaxCellCandidates="), MaxCellCandidates);
+	const bool bFailOnConflicts = FParse::Param(*Params, TEXT("FailOnConflicts"));
+	const bool bFailOnNoOp = FParse::Param(*Params, TEXT("FailOnNoOp"));
+	const bool bMerge = FParse::Param(*Params, TEXT("Merge"));
+	const bool bSave = FParse::Param(*Params, TEXT("Save"));
+	float MergeTolerance = 1.0f;
+	FParse::Value(*Params, TEXT("MergeTolerance="), MergeTolerance);
+	CellSize = FMath::Max(CellSize, 1.0f);
+	SampleSpacing = FMath::Max(SampleSpacing, 1.0f);
+
+	UWorld* World = LoadLayoutWorld(MapName);
+	if (!World)
+	{
+		UE_LOG(LogLocalLightingVolume, Error, TEXT("Can not load map %s."), *MapName);
+		return 1;
+	}
+
+	TArray<ALocalLightingVolumeBase*> Volumes;
+	TArray<FBox> VolumeBounds;
+	TArray<FLocalLightingOverridePayload> Payloads;
+	FBox LayoutBounds(ForceInit);
+	for (TActorIterator<ALocalLightingVolumeBase> It(World); It; ++It)
+	{
+		Volumes.Add(*It);
+		VolumeBounds.Add(It->GetShapeBounds());
+		It->GetOverridePayload(Payloads.AddDefaulted_GetRef());
+		LayoutBounds += VolumeBounds.Last();
+	}
+	UE_LOG(LogLocalLightingVolume, Display, TEXT("%s: %d Local Lighting Volumes."), *MapName, Volumes.Num());
+
+	int32 NumFailures = 0;
+
+	// Candidates per spatial cell: Volumes whose bounds overlap the cell, i.e. tested exactly by a View Point in it.
+	int32 MaxCandidates = 0;
+	double AverageCandidates = 0.0;
+	FVector WorstCellCenter = FVector::ZeroVector;
+	TArray<FVector> CellViewPoints;
+	if (LayoutBounds.IsValid)
+	{
+		const FVector LayoutSize = LayoutBounds.GetSize();
+		auto CountCells = [&LayoutSize](float Size)
+		{
+			return FIntVector(FMath::Max(FMath::CeilToInt(LayoutSize.X / Size), 1), FMath::Max(FMath::CeilToInt(LayoutSize.Y / Size), 1), FMath::Max(FMath::CeilToInt(LayoutSize.Z / Size), 1));
+		};
+		FIntVector NumCells = CountCells(CellSize);
+		while (int64(NumCells.X) * NumCells.Y * NumCells.Z > MaxLayoutCells)
+		{
+			CellSize *= 2.0f;
+			NumCells = CountCells(CellSize);
+		}
+
+		TArray<int32> CellCandidates;
+		CellCandidates.SetNumZeroed(NumCells.X * NumCells.Y * NumCells.Z);
+		auto ToCell = [&LayoutBounds, CellSize, &NumCells](const FVector& Point)
+		{
+			const FVector Cell = (Point - LayoutBounds.Min) / CellSize;
+			return FIntVector(FMath::Clamp(FMath::FloorToInt(Cell.X), 0, NumCells.X - 1), FMath::Clamp(FMath::FloorToInt(Cell.Y), 0, NumCells.Y - 1), FMath::Clamp(FMath::FloorToInt(Cell.Z), 0, NumCells.Z - 1));
+		};
+		for (const FBox& Bounds : VolumeBounds)
+		{
+			const FIntVector MinCell = ToCell(Bounds.Min);
+			const FIntVector MaxCell = ToCell(Bounds.Max);
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+			{
+				for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+				{
+					for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+					{
+						CellCandidates[(Z * NumCells.Y + Y) * NumCells.X + X]++;
+					}
+				}
+			}
+		}
+
+		int32 NumOccupiedCells = 0;
+		for (int32 CellIndex = 0; CellIndex < CellCandidates.Num(); CellIndex++)
+		{
+			if (CellCandidates[CellIndex] > 0)
+			{
+				const FVector CellCenter = LayoutBounds.Min + (FVector(CellIndex % NumCells.X, (CellIndex / NumCells.X) % NumCells.Y, CellIndex / (NumCells.X * NumCells.Y)) + 0.5f) * CellSize;
+				CellViewPoints.Add(CellCenter);
+				NumOccupiedCells++;
+				AverageCandidates += CellCandidates[CellIndex];
+				if (CellCandidates[CellIndex] > MaxCandidates)
+				{
+					MaxCandidates = CellCandidates[CellIndex];
+					WorstCellCenter = CellCenter;
+				}
+			}
+		}
+		AverageCandidates = NumOccupiedCells > 0 ? AverageCandidates / NumOccupiedCells : 0.0;
+		UE_LOG(LogLocalLightingVolume, Display, TEXT("Candidates per %.0f cm cell: max %d at %s, average %.2f over %d occupied cells."), CellSize, MaxCandidates, *WorstCellCenter.ToString(), AverageCandidates, NumOccupiedCells);
+	}
+	if (MaxCandidates > MaxCellCandidates)
+	{
+		UE_LOG(LogLocalLightingVolume, Error, TEXT("Candidates per cell %d exceed the limit of %d."), MaxCandidates, MaxCellCandidates);
+		NumFailures++;
+	}
+
+	// Overlap depth and containment cost, along navigation paths when the map has a navigation mesh.
+	FMath::RandInit(Seed);
+	TArray<FVector> PathViewPoints;
+	SampleNavigationPaths(World, PathCount, SampleSpacing, EyeHeight, PathViewPoints);
+	if (PathViewPoints.Num() == 0)
+	{
+		UE_LOG(LogLocalLightingVolume, Warning, TEXT("No navigation path could be sampled, the containment cost is estimated at the cell centers instead."));
+	}
+
+	// Bounds of the Volumes, filtered the same way as the dense Volumes of ULocalLightingSubsystem.
+	FLocalLightingCandidateFilter CandidateFilter;
+	for (const FBox& Bounds : VolumeBounds)
+	{
+		CandidateFilter.Add(Bounds);
+	}
+
+	auto MeasureViewPoints = [&Volumes, &CandidateFilter](const TArray<FVector>& ViewPoints, int32& OutMaxDepth, double& OutAverageDepth, double& OutMaxMs, double& OutAverageMs)
+	{
+		OutMaxDepth = 0;
+		OutAverageDepth = 0.0;
+		OutMaxMs = 0.0;
+		OutAverageMs = 0.0;
+		int32 NumEncompassedViewPoints = 0;
+		TArray<int32, TInlineAllocator<64>> Candidates;
+		for (const FVector& ViewPoint : ViewPoints)
+		{
+			// Same containment work as one evaluation of ULocalLightingSubsystem, only the candidates test their exact Shape.
+			int32 Depth = 0;
+			const uint32 StartCycles = FPlatformTime::Cycles();
+			Candidates.Reset();
+			CandidateFilter.GatherCandidates(ViewPoint, Candidates);
+			for (int32 Index : Candidates)
+			{
+				Depth += Volumes[Index]->EncompassesViewPoint(ViewPoint) ? 1 : 0;
+			}
+			const double Ms = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - StartCycles);
+
+			OutMaxMs = FMath::Max(OutMaxMs, Ms);
+			OutAverageMs += Ms;
+			OutMaxDepth = FMath::Max(OutMaxDepth, Depth);
+			if (Depth > 0)
+			{
+				OutAverageDepth += Depth;
+				NumEncompassedViewPoints++;
+			}
+		}
+		OutAverageMs = ViewPoints.Num() > 0 ? OutAverageMs / ViewPoints.Num() : 0.0;
+		OutAverageDepth = NumEncompassedViewPoints > 0 ? OutAverageDepth / NumEncompassedViewPoints : 0.0;
+	};
+
+	// The containment cost is measured where the View Point actually goes when the paths could be sampled.
+	int32 CellMaxDepth = 0;
+	double CellAverageDepth = 0.0;
+	double MaxMs = 0.0;
+	double AverageMs = 0.0;
+	MeasureViewPoints(CellViewPoints, CellMaxDepth, CellAverageDepth, MaxMs, AverageMs);
+	UE_LOG(LogLocalLightingVolume, Display, TEXT("Overlap depth at %d occupied cell centers: max %d, average %.2f."), CellViewPoints.Num(), CellMaxDepth, CellAverageDepth);
+	if (CellMaxDepth > MaxOverlapDepth)
+	{
+		UE_LOG(LogLocalLightingVolume, Error, TEXT("Overlap depth %d at the occupied cell centers exceeds the limit of %d."), CellMaxDepth, MaxOverlapDepth);
+		NumFailures++;
+	}
+	if (PathViewPoints.Num() > 0)
+	{
+		int32 PathMaxDepth = 0;
+		double PathAverageDepth = 0.0;
+		MeasureViewPoints(PathViewPoints, PathMaxDepth, PathAverageDepth, MaxMs, AverageMs);
+		UE_LOG(LogLocalLightingVolume, Display, TEXT("Overlap depth along %d path samples: max %d, average %.2f."), PathViewPoints.Num(), PathMaxDepth, PathAverageDepth);
+		if (PathMaxDepth > MaxOverlapDepth)
+		{
+			UE_LOG(LogLocalLightingVolume, Error, TEXT("Overlap depth %d along the paths exceeds the limit of %d."), PathMaxDepth, MaxOverlapDepth);
+			NumFailures++;
+		}
+	}
+	UE_LOG(LogLocalLightingVolume, Display, TEXT("Containment cost per evaluation %s: max %.4f ms, average %.4f ms."),
+		PathViewPoints.Num() > 0 ? TEXT("along the paths") : TEXT("at the cell centers"), MaxMs, AverageMs);
+
+	// Volumes overriding the same property of the same target differently where they overlap.
+	int32 NumConflicts = 0;
+	for (int32 IndexA = 0; IndexA < Volumes.Num(); IndexA++)
+	{
+		for (int32 IndexB = IndexA + 1; IndexB < Volumes.Num(); IndexB++)
+		{
+			if (Volumes[IndexA]->GetOverrideTarget() != Volumes[IndexB]->GetOverrideTarget() || !VolumeBounds[IndexA].Intersect(VolumeBounds[IndexB]))
+			{
+				continue;
+			}
+			for (const FName& Name : FLocalLightingOverrideDiff::Compute(Payloads[IndexA], Payloads[IndexB]).Changed)
+			{
+				UE_LOG(LogLocalLightingVolume, Warning, TEXT("Conflict: %s and %s override %s of %s differently (%s, %s)."),
+					*Volumes[IndexA]->GetActorNameOrLabel(), *Volumes[IndexB]->GetActorNameOrLabel(), *Name.ToString(),
+					*GetNameSafe(Volumes[IndexA]->GetOverrideTarget()), *Payloads[IndexA][Name], *Payloads[IndexB][Name]);
+				NumConflicts++;
+			}
+		}
+	}
+
+	int32 NumNoOps = 0;
+	int32 NumSkyRecaptures = 0;
+	for (int32 Index = 0; Index < Volumes.Num(); Index++)
+	{
+		if (IsNoOpVolume(Volumes[Index], Payloads[Index]))
+		{
+			UE_LOG(LogLocalLightingVolume, Warning, TEXT("No-op: %s only overrides values equal to those of %s."), *Volumes[Index]->GetActorNameOrLabel(), *GetNameSafe(Volumes[Index]->GetOverrideTarget()));
+			NumNoOps++;
+		}
+		if (Volumes[Index]->TriggersSkyRecapture())
+		{
+			UE_LOG(LogLocalLightingVolume, Display, TEXT("Sky recapture: %s recaptures %s on enter and exit."), *Volumes[Index]->GetActorNameOrLabel(), *GetNameSafe(Volumes[Index]->GetOverrideTarget()));
+			NumSkyRecaptures++;
+		}
+	}
+	UE_LOG(LogLocalLightingVolume, Display, TEXT("%d conflicts, %d no-op Volumes, %d Volumes triggering sky recaptures."), NumConflicts, NumNoOps, NumSkyRecaptures);
+	if (bFailOnConflicts && NumConflicts > 0)
+	{
+		NumFailures++;
+	}
+	if (bFailOnNoOp && NumNoOps > 0)
+	{
+		NumFailures++;
+	}
+
+#if WITH_EDITOR
+	if (bMerge)
+	{
+		// Compare the containment cost at the same View Points once the Volumes are merged.
+		const TArray<FVector>& CostViewPoints = PathViewPoints.Num() > 0 ? PathViewPoints : CellViewPoints;
+		const int32 NumVolumesBefore = Volumes.Num();
+		const int32 NumMerged = MergeRedundantVolumes(World, Volumes, VolumeBounds, MergeTolerance);
+
+		Volumes.Reset();
+		CandidateFilter.Reset();
+		for (TActorIterator<ALocalLightingVolumeBase> It(World); It; ++It)
+		{
+			Volumes.Add(*It);
+			CandidateFilter.Add(It->GetShapeBounds());
+		}
+		int32 MergedMaxDepth = 0;
+		double MergedAverageDepth = 0.0;
+		double MergedMaxMs = 0.0;
+		double MergedAverageMs = 0.0;
+		MeasureViewPoints(CostViewPoints, MergedMaxDepth, MergedAverageDepth, MergedMaxMs, MergedAverageMs);
+		UE_LOG(LogLocalLightingVolume, Display, TEXT("Merge: %d -> %d Volumes, containment cost per evaluation: max %.4f -> %.4f ms, average %.4f -> %.4f ms."),
+			NumVolumesBefore, Volumes.Num(), MaxMs, MergedMaxMs, AverageMs, MergedAverageMs);
+
+		if (bSave && NumMerged > 0 && World->PersistentLevel->IsUsingExternalActors())
+		{
+			// The merged Volumes live in their own packages, saving the map package alone would leave the destroyed ones behind.
+			UE_LOG(LogLocalLightingVolume, Error, TEXT("Can not save map %s, its actors are saved in external packages. Merge its Volumes in the editor instead."), *World->GetOutermost()->GetName());
+			NumFailures++;
+		}
+		else if (bSave && NumMerged > 0)
+		{
+			UPackage* Package = World->GetOutermost();
+			const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetMapPackageExtension());
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Standalone;
+			if (!UPackage::SavePackage(Package, World, *Filename, SaveArgs))
+			{
+				UE_LOG(LogLocalLightingVolume, Error, TEXT("Can not save map %s."), *Filename);
+				NumFailures++;
+			}
+		}
+	}
+#endif
+
+	UnloadLayoutWorld(World);
+	return NumFailures > 0 ? 1 : 0;
+}
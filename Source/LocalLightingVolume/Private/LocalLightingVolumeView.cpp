@@ -9,6 +9,8 @@
 #include "LocalLightingVolumeView.h"
 
 // Engine Include
+#include "Engine/World.h"
+#include "RenderingThread.h"
 #include "SceneView.h"
 #include "SceneInterface.h"
 
@@ -18,18 +20,98 @@
 FLocalLightingVolumeViewExtension::FLocalLightingVolumeViewExtension(const FAutoRegister& AutoRegister)
 	: FSceneViewExtensionBase(AutoRegister)
 {
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FLocalLightingVolumeViewExtension::OnWorldCleanup);
+}
+
+FLocalLightingVolumeViewExtension::~FLocalLightingVolumeViewExtension()
+{
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+}
+
+bool FLocalLightingVolumeViewExtension::IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const
+{
+	const ULocalLightingSubsystem* Subsystem = FindSubsystem(Context.Scene);
+	return Subsystem && Subsystem->HasVolumes();
 }
 
 void FLocalLightingVolumeViewExtension::SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView)
 {
-	if (InViewFamily.Scene)
+	ULocalLightingSubsystem* Subsystem = FindSubsystem(InViewFamily.Scene);
+	if (!Subsystem || Subsystem->IsUsingPerViewOverrides())
+	{
+		return;
+	}
+
+	// The subsystem evaluates on its own at a fixed rate once a View Point provider is bound or a baked Sequence plays.
+	if (!Subsystem->HasViewPointProvider() && !Subsystem->IsPlayingBakedSequence())
+	{
+		Subsystem->ProcessVolume(InView.ViewLocation);
+	}
+}
+
+void FLocalLightingVolumeViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
+{
+	TArray<FLocalLightingViewOverrides, TInlineAllocator<4>> ViewOverrides;
+	ULocalLightingSubsystem* Subsystem = FindSubsystem(InViewFamily.Scene);
+	if (Subsystem && Subsystem->IsUsingPerViewOverrides())
+	{
+		ViewOverrides.SetNum(InViewFamily.Views.Num());
+		for (int32 ViewIndex = 0; ViewIndex < InViewFamily.Views.Num(); ViewIndex++)
+		{
+			Subsystem->ResolveViewOverrides(InViewFamily.Views[ViewIndex]->ViewLocation, ViewOverrides[ViewIndex]);
+		}
+	}
+
+	if (ViewOverrides.Num() == 0 && !bSentViewOverrides)
+	{
+		return;
+	}
+	bSentViewOverrides = ViewOverrides.Num() > 0;
+
+	// Enqueued right before the rendering of this View Family, the extension is kept alive until it runs.
+	ENQUEUE_RENDER_COMMAND(LocalLightingVolumeViewOverrides)(
+		[Self = StaticCastSharedRef<FLocalLightingVolumeViewExtension>(AsShared()), ViewOverrides = MoveTemp(ViewOverrides)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			Self->ViewOverrides_RenderThread = MoveTemp(ViewOverrides);
+		});
+}
+
+void FLocalLightingVolumeViewExtension::PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView)
+{
+	// Called before the uniform buffers of the View are set up from its post process settings.
+	const int32 ViewIndex = InView.Family ? InView.Family->Views.IndexOfByKey(&InView) : INDEX_NONE;
+	if (ViewOverrides_RenderThread.IsValidIndex(ViewIndex))
+	{
+		ViewOverrides_RenderThread[ViewIndex].Apply(InView.FinalPostProcessSettings.IndirectLightingIntensity, InView.FinalPostProcessSettings.IndirectLightingColor);
+	}
+}
+
+ULocalLightingSubsystem* FLocalLightingVolumeViewExtension::FindSubsystem(const FSceneInterface* Scene) const
+{
+	UWorld* World = Scene ? Scene->GetWorld() : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// A Scene freed and allocated again at the same address belongs to another World.
+	FSceneSubsystem& SceneSubsystem = SceneSubsystems.FindOrAdd(Scene);
+	if (SceneSubsystem.World.Get() != World)
+	{
+		SceneSubsystem.World = World;
+		SceneSubsystem.Subsystem = ULocalLightingSubsystem::Get(World);
+	}
+	return SceneSubsystem.Subsystem.Get();
+}
+
+void FLocalLightingVolumeViewExtension::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	// The subsystems of a World are created again when it is initialized again, e.g. reloading a map in the editor.
+	for (auto It = SceneSubsystems.CreateIterator(); It; ++It)
 	{
-		if (UWorld* World = InViewFamily.Scene->GetWorld())
-        {
-        	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(World))
-        	{
-        		Subsystem->ProcessVolume(InView.ViewLocation);
-        	}
-        }
+		if (!It->Value.World.IsValid() || It->Value.World.Get() == World)
+		{
+			It.RemoveCurrent();
+		}
 	}
 }
@@ -0,0 +1,137 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalSkyAtmosphereVolume.h"
+
+// Engine Include
+#include "Components/BrushComponent.h"
+#include "Components/SkyAtmosphereComponent.h"
+
+// Plugins Include
+#include "LocalConsoleVariableOverrides.h"
+
+static USkyAtmosphereComponent* GetSkyAtmosphereComponent(ASkyAtmosphere* SkyAtmosphere)
+{
+	return SkyAtmosphere->GetComponent();
+}
+
+ALocalSkyAtmosphereVolume::ALocalSkyAtmosphereVolume()
+{
+	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+	GetBrushComponent()->Mobility = EComponentMobility::Movable;
+
+	bOverride_bVisible = false;
+	bOverride_bFastSkyLUT = false;
+	bOverride_FastSkyLUTSampleCountMax = false;
+	bOverride_SampleCountMax = false;
+
+	SkyAtmosphere = nullptr;
+	bVisible = true;
+	bFastSkyLUT = true;
+	FastSkyLUTSampleCountMax = 32.0f;
+	SampleCountMax = 32.0f;
+
+	bCacheVisible = true;
+}
+
+void ALocalSkyAtmosphereVolume::PostUnregisterAllComponents()
+{
+	// The Sky Atmosphere may stay loaded when this Volume streams out, and the LUT settings are process wide.
+	if (bViewPointInVolume)
+	{
+		RestoreLighting();
+		bViewPointInVolume = false;
+	}
+
+	Super::PostUnregisterAllComponents();
+}
+
+AActor* ALocalSkyAtmosphereVolume::GetOverrideTarget() const
+{
+	return SkyAtmosphere.Get();
+}
+
+void ALocalSkyAtmosphereVolume::OverrideLighting()
+{
+	bOverridingLighting = false;
+	if (USkyAtmosphereComponent* Component = SkyAtmosphere.IsValid() ? GetSkyAtmosphereComponent(SkyAtmosphere.Get()) : nullptr)
+	{
+		if (bOverride_bVisible)
+		{
+			bCacheVisible = Component->GetVisibleFlag();
+			if (bCacheVisible != bVisible)
+			{
+				Component->SetVisibility(bVisible);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+	}
+	if (bOverride_bFastSkyLUT)
+	{
+		bOverridingLighting |= FLocalConsoleVariableOverrides::Get().Push(this, TEXT("r.SkyAtmosphere.FastSkyLUT"), bFastSkyLUT ? TEXT("1") : TEXT("0"));
+	}
+	if (bOverride_FastSkyLUTSampleCountMax)
+	{
+		bOverridingLighting |= FLocalConsoleVariableOverrides::Get().Push(this, TEXT("r.SkyAtmosphere.FastSkyLUT.SampleCountMax"), FString::SanitizeFloat(FastSkyLUTSampleCountMax));
+	}
+	if (bOverride_SampleCountMax)
+	{
+		bOverridingLighting |= FLocalConsoleVariableOverrides::Get().Push(this, TEXT("r.SkyAtmosphere.SampleCountMax"), FString::SanitizeFloat(SampleCountMax));
+	}
+}
+
+void ALocalSkyAtmosphereVolume::RestoreLighting()
+{
+	if (USkyAtmosphereComponent* Component = SkyAtmosphere.IsValid() ? GetSkyAtmosphereComponent(SkyAtmosphere.Get()) : nullptr)
+	{
+		if (bOverride_bVisible)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyAtmosphereVolume, bVisible), bCacheVisible != bVisible))
+			{
+				Component->SetVisibility(bCacheVisible);
+				RecordDebugMutation();
+			}
+		}
+	}
+	FLocalConsoleVariableOverrides::Get().PopAll(this);
+	bOverridingLighting = false;
+}
+
+#if WITH_EDITOR
+void ALocalSkyAtmosphereVolume::PreEditChange(FProperty* PropertyAboutToChange)
+{
+	// Pop the Console Variable overrides of this Volume, PostEditChangeProperty pushes the edited values on top again.
+	if (bViewPointInVolume)
+	{
+		RestoreLighting();
+	}
+	Super::PreEditChange(PropertyAboutToChange);
+}
+
+void ALocalSkyAtmosphereVolume::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (bViewPointInVolume)
+	{
+		OverrideLighting();
+	}
+}
+
+bool ALocalSkyAtmosphereVolume::CanEditChange(const FProperty* InProperty) const
+{
+	const FName PropertyName = InProperty->GetFName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyAtmosphereVolume, bVisible))
+	{
+		return SkyAtmosphere.IsValid();
+	}
+
+	return Super::CanEditChange(InProperty);
+}
+#endif
@@ -11,43 +11,111 @@
 // Engine Include
 #include "Components/BrushComponent.h"
 #include "Engine/SkyLight.h"
+#include "Engine/TextureCube.h"
 
 // Plugins Include
+#include "LocalConsoleVariableOverrides.h"
 #include "LocalLightingSubsystem.h"
 
 /**
- * Had better to add this function into Engine
- *		void USkyLightComponent::SetLowerHemisphereIsBlack(bool InbLowerHemisphereIsBlack)
+ * Recaptures go through the scheduler of ULocalLightingSubsystem, which coalesces them and enforces a minimum interval.
  */
-void SetLowerHemisphereIsBlack(USkyLightComponent* SkyLightComponent, bool InbLowerHemisphereIsBlack)
+static void RequestSkyCapture(const ALocalSkyLightVolume* Volume, USkyLightComponent* SkyLightComponent, bool bCoveredByRealTimeCapture = false)
 {
-	if (!SkyLightComponent)
+	if (ULocalLightingSubsystem* Subsystem = ULocalLightingSubsystem::Get(SkyLightComponent))
 	{
-		return;
+		Subsystem->RequestSkyCapture(SkyLightComponent, bCoveredByRealTimeCapture, Volume);
+	}
+	else
+	{
+		SkyLightComponent->SetCaptureIsDirty();
 	}
+}
 
-	// Can't set on a static light
-	auto AreDynamicDataChangesAllowed = [](const USkyLightComponent* Component, bool bIgnoreStationary = true)
+/** Can't set on a static light, mirrors USkyLightComponent::AreDynamicDataChangesAllowed. */
+static bool AreDynamicDataChangesAllowed(const USkyLightComponent* Component, bool bIgnoreStationary = true)
+{
+	if (!Component)
 	{
-		if (!Component)
-		{
-			return false;
-		}
-		return (Component->IsOwnerRunningUserConstructionScript()) || !(Component->IsRegistered() && (Component->Mobility == EComponentMobility::Static || (!bIgnoreStationary && Component->Mobility == EComponentMobility::Stationary)));
-	};
+		return false;
+	}
+	return (Component->IsOwnerRunningUserConstructionScript()) || !(Component->IsRegistered() && (Component->Mobility == EComponentMobility::Static || (!bIgnoreStationary && Component->Mobility == EComponentMobility::Stationary)));
+}
 
+/**
+ * Had better to add this function into Engine
+ *		void USkyLightComponent::SetLowerHemisphereIsBlack(bool InbLowerHemisphereIsBlack)
+ */
+void SetLowerHemisphereIsBlack(const ALocalSkyLightVolume* Volume, USkyLightComponent* SkyLightComponent, bool InbLowerHemisphereIsBlack)
+{
 	if (AreDynamicDataChangesAllowed(SkyLightComponent) && SkyLightComponent->bLowerHemisphereIsBlack != InbLowerHemisphereIsBlack)
 	{
 		SkyLightComponent->bLowerHemisphereIsBlack = InbLowerHemisphereIsBlack;
 		SkyLightComponent->MarkRenderStateDirty();
-		SkyLightComponent->SetCaptureIsDirty();
+		Volume->RecordDebugMutation();
+		RequestSkyCapture(Volume, SkyLightComponent, true);
 	}
 }
 
+/**
+ * USkyLightComponent::SetRealTimeCapture dirties the capture right away,
+ * bypassing the scheduler of ULocalLightingSubsystem and its minimum interval.
+ */
+static void SetRealTimeCapture(const ALocalSkyLightVolume* Volume, USkyLightComponent* SkyLightComponent, bool bInRealTimeCapture)
+{
+	if (AreDynamicDataChangesAllowed(SkyLightComponent) && SkyLightComponent->bRealTimeCapture != bInRealTimeCapture)
+	{
+		SkyLightComponent->bRealTimeCapture = bInRealTimeCapture;
+		SkyLightComponent->MarkRenderStateDirty();
+		Volume->RecordDebugMutation();
+		RequestSkyCapture(Volume, SkyLightComponent);
+	}
+}
+
+/** Same as SetRealTimeCapture, USkyLightComponent::SetCubemap dirties the capture right away. */
+static void SetCubemap(const ALocalSkyLightVolume* Volume, USkyLightComponent* SkyLightComponent, UTextureCube* InCubemap)
+{
+	if (AreDynamicDataChangesAllowed(SkyLightComponent) && SkyLightComponent->Cubemap != InCubemap)
+	{
+		SkyLightComponent->Cubemap = InCubemap;
+		SkyLightComponent->MarkRenderStateDirty();
+		Volume->RecordDebugMutation();
+		RequestSkyCapture(Volume, SkyLightComponent);
+	}
+}
+
+/**
+ * Time slicing of the real time capture is a renderer setting rather than a Sky Light Component property,
+ * so it is stacked with the other Console Variable overrides and the last Volume to pop it restores the value set before.
+ */
+static const TCHAR* RealTimeCaptureTimeSliceName = TEXT("r.SkyLight.RealTimeReflectionCapture.TimeSlice");
+
+static bool PushRealTimeCaptureTimeSliced(const ALocalSkyLightVolume* Volume, bool bTimeSliced)
+{
+	return FLocalConsoleVariableOverrides::Get().Push(Volume, RealTimeCaptureTimeSliceName, bTimeSliced ? TEXT("1") : TEXT("0"));
+}
+
+static void PopRealTimeCaptureTimeSliced(const ALocalSkyLightVolume* Volume)
+{
+	FLocalConsoleVariableOverrides::Get().Pop(Volume, RealTimeCaptureTimeSliceName);
+}
+
+#if WITH_EDITOR
+/**
+ * Whether the override is applied to the Sky Light without invalidating its capture.
+ */
+static bool IsCaptureFreeProperty(FName PropertyName)
+{
+	return PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, Intensity) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, LightColor) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, IndirectLightingIntensity) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, VolumetricScatteringIntensity);
+}
+#endif
+
 ALocalSkyLightVolume::ALocalSkyLightVolume()
 {
 	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
-	GetBrushComponent()->bAlwaysCreatePhysicsState = true;
 	GetBrushComponent()->Mobility = EComponentMobility::Movable;
 
 	bOverride_bRealTimeCapture = false;
@@ -59,6 +127,9 @@ ALocalSkyLightVolume::ALocalSkyLightVolume()
 	bOverride_VolumetricScatteringIntensity = false;
 	bOverride_bLowerHemisphereIsBlack = false;
 	bOverride_LowerHemisphereColor = false;
+	bOverride_bAffectsWorld = false;
+	bOverride_CubemapResolution = false;
+	bOverride_bRealTimeCaptureTimeSliced = false;
 
 	SkyLight = nullptr;
 	bRealTimeCapture = false;
@@ -70,6 +141,9 @@ ALocalSkyLightVolume::ALocalSkyLightVolume()
 	VolumetricScatteringIntensity = 1.0f;
 	bLowerHemisphereIsBlack = true;
 	LowerHemisphereColor = FLinearColor::Black;
+	bAffectsWorld = true;
+	CubemapResolution = 128;
+	bRealTimeCaptureTimeSliced = true;
 
 	bCacheRealTimeCapture = false;
 	CacheSourceType = SLS_CapturedScene;
@@ -80,6 +154,8 @@ ALocalSkyLightVolume::ALocalSkyLightVolume()
 	CacheVolumetricScatteringIntensity = 1.0f;
 	bCacheLowerHemisphereIsBlack = true;
 	CacheLowerHemisphereColor = FLinearColor::Black;
+	bCacheAffectsWorld = true;
+	CacheCubemapResolution = 128;
 
 #if WITH_EDITORONLY_DATA
 	CacheSkyLight = nullptr;
@@ -92,9 +168,30 @@ ALocalSkyLightVolume::ALocalSkyLightVolume()
 	bCacheOverride_VolumetricScatteringIntensity = false;
 	bCacheOverride_bLowerHemisphereIsBlack = false;
 	bCacheOverride_LowerHemisphereColor = false;
+	bCacheOverride_bAffectsWorld = false;
+	bCacheOverride_CubemapResolution = false;
+	bCacheOverride_bRealTimeCaptureTimeSliced = false;
 #endif
 }
 
+void ALocalSkyLightVolume::GetReferencedTextures(TArray<UTexture*>& OutTextures) const
+{
+	if (bOverride_Cubemap && Cubemap)
+	{
+		OutTextures.Add(Cubemap);
+	}
+}
+
+AActor* ALocalSkyLightVolume::GetOverrideTarget() const
+{
+	return SkyLight.Get();
+}
+
+bool ALocalSkyLightVolume::TriggersSkyRecapture() const
+{
+	return bOverride_bRealTimeCapture || bOverride_SourceType || bOverride_Cubemap || bOverride_bLowerHemisphereIsBlack || bOverride_LowerHemisphereColor || bOverride_CubemapResolution;
+}
+
 void ALocalSkyLightVolume::OverrideLighting()
 {
 	bOverridingLighting = false;
@@ -105,7 +202,7 @@ void ALocalSkyLightVolume::OverrideLighting()
 			bCacheRealTimeCapture = SkyLight->GetLightComponent()->bRealTimeCapture;
 			if (bCacheRealTimeCapture != bRealTimeCapture)
 			{
-				SkyLight->GetLightComponent()->SetRealTimeCapture(bRealTimeCapture);
+				SetRealTimeCapture(this, SkyLight->GetLightComponent(), bRealTimeCapture);
 				bOverridingLighting |= true;
 			}
 		}
@@ -116,7 +213,8 @@ void ALocalSkyLightVolume::OverrideLighting()
 			{
 				SkyLight->GetLightComponent()->SourceType = SourceType;
 				SkyLight->GetLightComponent()->MarkRenderStateDirty();
-				SkyLight->GetLightComponent()->SetCaptureIsDirty();
+				RequestSkyCapture(this, SkyLight->GetLightComponent());
+				RecordDebugMutation();
 				bOverridingLighting |= true;
 			}
 		}
@@ -125,43 +223,43 @@ void ALocalSkyLightVolume::OverrideLighting()
 			CacheCubemap = SkyLight->GetLightComponent()->Cubemap;
 			if (CacheCubemap != Cubemap)
 			{
-				SkyLight->GetLightComponent()->SetCubemap(Cubemap);
+				SetCubemap(this, SkyLight->GetLightComponent(), Cubemap);
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_Intensity)
 		{
-			CacheIntensity = SkyLight->GetLightComponent()->Intensity;
+			CacheIntensity = GetSettledLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity);
 			if (CacheIntensity != Intensity)
 			{
-				SkyLight->GetLightComponent()->SetIntensity(Intensity);
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity, ApplyBlendWeight(CacheIntensity, Intensity));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_LightColor)
 		{
-			CacheLightColor = SkyLight->GetLightComponent()->GetLightColor().ToFColor(true);
+			CacheLightColor = GetSettledLightColor(SkyLight->GetLightComponent()).ToFColor(true);
 			if (CacheLightColor != LightColor)
 			{
-				SkyLight->GetLightComponent()->SetLightColor(FLinearColor::FromSRGBColor(LightColor));
+				BlendLightProperty(SkyLight->GetLightComponent(), ApplyBlendWeight(FLinearColor::FromSRGBColor(CacheLightColor), FLinearColor::FromSRGBColor(LightColor)));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_IndirectLightingIntensity)
 		{
-			CacheIndirectLightingIntensity = SkyLight->GetLightComponent()->IndirectLightingIntensity;
+			CacheIndirectLightingIntensity = GetSettledLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity);
 			if (CacheIndirectLightingIntensity != IndirectLightingIntensity)
 			{
-				SkyLight->GetLightComponent()->SetIndirectLightingIntensity(IndirectLightingIntensity);
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity, ApplyBlendWeight(CacheIndirectLightingIntensity, IndirectLightingIntensity));
 				bOverridingLighting |= true;
 			}
 		}
 		if (bOverride_VolumetricScatteringIntensity)
 		{
-			CacheVolumetricScatteringIntensity = SkyLight->GetLightComponent()->VolumetricScatteringIntensity;
+			CacheVolumetricScatteringIntensity = GetSettledLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity);
 			if (CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity)
 			{
-				SkyLight->GetLightComponent()->SetVolumetricScatteringIntensity(VolumetricScatteringIntensity);
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity, ApplyBlendWeight(CacheVolumetricScatteringIntensity, VolumetricScatteringIntensity));
 				bOverridingLighting |= true;
 			}
 		}
@@ -170,7 +268,7 @@ void ALocalSkyLightVolume::OverrideLighting()
 			bCacheLowerHemisphereIsBlack = SkyLight->GetLightComponent()->bLowerHemisphereIsBlack;
 			if (bCacheLowerHemisphereIsBlack != bLowerHemisphereIsBlack)
 			{
-				SetLowerHemisphereIsBlack(SkyLight->GetLightComponent(), bLowerHemisphereIsBlack);
+				SetLowerHemisphereIsBlack(this, SkyLight->GetLightComponent(), bLowerHemisphereIsBlack);
 				bOverridingLighting |= true;
 			}
 		}
@@ -180,9 +278,37 @@ void ALocalSkyLightVolume::OverrideLighting()
 			if (CacheLowerHemisphereColor != LowerHemisphereColor)
 			{
 				SkyLight->GetLightComponent()->SetLowerHemisphereColor(LowerHemisphereColor);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_bAffectsWorld)
+		{
+			bCacheAffectsWorld = SkyLight->GetLightComponent()->bAffectsWorld;
+			if (bCacheAffectsWorld != bAffectsWorld)
+			{
+				SkyLight->GetLightComponent()->bAffectsWorld = bAffectsWorld;
+				SkyLight->GetLightComponent()->MarkRenderStateDirty();
+				RecordDebugMutation();
 				bOverridingLighting |= true;
 			}
 		}
+		if (bOverride_CubemapResolution)
+		{
+			CacheCubemapResolution = SkyLight->GetLightComponent()->CubemapResolution;
+			if (CacheCubemapResolution != CubemapResolution)
+			{
+				SkyLight->GetLightComponent()->CubemapResolution = CubemapResolution;
+				SkyLight->GetLightComponent()->MarkRenderStateDirty();
+				RequestSkyCapture(this, SkyLight->GetLightComponent());
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_bRealTimeCaptureTimeSliced)
+		{
+			bOverridingLighting |= PushRealTimeCaptureTimeSliced(this, bRealTimeCaptureTimeSliced);
+		}
 	}
 }
 
@@ -192,73 +318,134 @@ void ALocalSkyLightVolume::RestoreLighting()
 	{
 		if (bOverride_bRealTimeCapture)
 		{
-			if (bCacheRealTimeCapture != bRealTimeCapture)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bRealTimeCapture), bCacheRealTimeCapture != bRealTimeCapture))
 			{
-				SkyLight->GetLightComponent()->SetRealTimeCapture(bCacheRealTimeCapture);
+				SetRealTimeCapture(this, SkyLight->GetLightComponent(), bCacheRealTimeCapture);
 			}
 		}
 		if (bOverride_SourceType)
 		{
-			if (CacheSourceType != SourceType)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, SourceType), CacheSourceType != SourceType))
 			{
 				SkyLight->GetLightComponent()->SourceType = CacheSourceType;
 				SkyLight->GetLightComponent()->MarkRenderStateDirty();
-				SkyLight->GetLightComponent()->SetCaptureIsDirty();
+				RequestSkyCapture(this, SkyLight->GetLightComponent());
+				RecordDebugMutation();
 			}
 		}
 		if (bOverride_Cubemap)
 		{
-			if (CacheCubemap != Cubemap)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, Cubemap), CacheCubemap != Cubemap))
 			{
-				SkyLight->GetLightComponent()->SetCubemap(CacheCubemap);
+				SetCubemap(this, SkyLight->GetLightComponent(), CacheCubemap);
 			}
 		}
 		if (bOverride_Intensity)
 		{
-			if (CacheIntensity != Intensity)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, Intensity), CacheIntensity != Intensity))
 			{
-				SkyLight->GetLightComponent()->SetIntensity(CacheIntensity);
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity, CacheIntensity);
 			}
 		}
 		if (bOverride_LightColor)
 		{
-			if (CacheLightColor != LightColor)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, LightColor), CacheLightColor != LightColor))
 			{
-				SkyLight->GetLightComponent()->SetLightColor(FLinearColor::FromSRGBColor(CacheLightColor));
+				BlendLightProperty(SkyLight->GetLightComponent(), FLinearColor::FromSRGBColor(CacheLightColor));
 			}
 		}
 		if (bOverride_IndirectLightingIntensity)
 		{
-			if (CacheIndirectLightingIntensity != IndirectLightingIntensity)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, IndirectLightingIntensity), CacheIndirectLightingIntensity != IndirectLightingIntensity))
 			{
-				SkyLight->GetLightComponent()->SetIndirectLightingIntensity(CacheIndirectLightingIntensity);
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity, CacheIndirectLightingIntensity);
 			}
 		}
 		if (bOverride_VolumetricScatteringIntensity)
 		{
-			if (CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, VolumetricScatteringIntensity), CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity))
 			{
-				SkyLight->GetLightComponent()->SetVolumetricScatteringIntensity(CacheVolumetricScatteringIntensity);
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity, CacheVolumetricScatteringIntensity);
 			}
 		}
 		if (bOverride_bLowerHemisphereIsBlack)
 		{
-			if (bCacheLowerHemisphereIsBlack != bLowerHemisphereIsBlack)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bLowerHemisphereIsBlack), bCacheLowerHemisphereIsBlack != bLowerHemisphereIsBlack))
 			{
-				SetLowerHemisphereIsBlack(SkyLight->GetLightComponent(), bCacheLowerHemisphereIsBlack);
+				SetLowerHemisphereIsBlack(this, SkyLight->GetLightComponent(), bCacheLowerHemisphereIsBlack);
 			}
 		}
 		if (bOverride_LowerHemisphereColor)
 		{
-			if (CacheLowerHemisphereColor != LowerHemisphereColor)
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, LowerHemisphereColor), CacheLowerHemisphereColor != LowerHemisphereColor))
 			{
 				SkyLight->GetLightComponent()->SetLowerHemisphereColor(CacheLowerHemisphereColor);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_bAffectsWorld)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bAffectsWorld), bCacheAffectsWorld != bAffectsWorld))
+			{
+				SkyLight->GetLightComponent()->bAffectsWorld = bCacheAffectsWorld;
+				SkyLight->GetLightComponent()->MarkRenderStateDirty();
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_CubemapResolution)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, CubemapResolution), CacheCubemapResolution != CubemapResolution))
+			{
+				SkyLight->GetLightComponent()->CubemapResolution = CacheCubemapResolution;
+				SkyLight->GetLightComponent()->MarkRenderStateDirty();
+				RequestSkyCapture(this, SkyLight->GetLightComponent());
+				RecordDebugMutation();
 			}
 		}
+		if (bOverride_bRealTimeCaptureTimeSliced)
+		{
+			PopRealTimeCaptureTimeSliced(this);
+		}
 	}
 	bOverridingLighting = false;
 }
 
+void ALocalSkyLightVolume::UpdateBlendWeight()
+{
+	// Only the numeric overrides follow the weight, the others are applied fully as soon as the View Point enters.
+	if (SkyLight.IsValid())
+	{
+		if (bOverride_Intensity)
+		{
+			if (CacheIntensity != Intensity)
+			{
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::Intensity, ApplyBlendWeight(CacheIntensity, Intensity));
+			}
+		}
+		if (bOverride_LightColor)
+		{
+			if (CacheLightColor != LightColor)
+			{
+				BlendLightProperty(SkyLight->GetLightComponent(), ApplyBlendWeight(FLinearColor::FromSRGBColor(CacheLightColor), FLinearColor::FromSRGBColor(LightColor)));
+			}
+		}
+		if (bOverride_IndirectLightingIntensity)
+		{
+			if (CacheIndirectLightingIntensity != IndirectLightingIntensity)
+			{
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::IndirectLightingIntensity, ApplyBlendWeight(CacheIndirectLightingIntensity, IndirectLightingIntensity));
+			}
+		}
+		if (bOverride_VolumetricScatteringIntensity)
+		{
+			if (CacheVolumetricScatteringIntensity != VolumetricScatteringIntensity)
+			{
+				BlendLightProperty(SkyLight->GetLightComponent(), ELocalLightingBlendProperty::VolumetricScatteringIntensity, ApplyBlendWeight(CacheVolumetricScatteringIntensity, VolumetricScatteringIntensity));
+			}
+		}
+	}
+}
+
 #if WITH_EDITOR
 void ALocalSkyLightVolume::PreEditChange(FProperty* PropertyAboutToChange)
 {
@@ -277,7 +464,10 @@ void ALocalSkyLightVolume::PreEditChange(FProperty* PropertyAboutToChange)
 			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, IndirectLightingIntensity) ||
 			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, VolumetricScatteringIntensity) ||
 			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, bLowerHemisphereIsBlack) ||
-			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, LowerHemisphereColor))
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, LowerHemisphereColor) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, bAffectsWorld) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, CubemapResolution) ||
+			PropertyName == GET_MEMBER_NAME_STRING_CHECKED(ALocalSkyLightVolume, bRealTimeCaptureTimeSliced))
 		{
 			bCacheOverride_bRealTimeCapture = bOverride_bRealTimeCapture;
 			bCacheOverride_SourceType = bOverride_SourceType;
@@ -288,6 +478,9 @@ void ALocalSkyLightVolume::PreEditChange(FProperty* PropertyAboutToChange)
 			bCacheOverride_VolumetricScatteringIntensity = bOverride_VolumetricScatteringIntensity;
 			bCacheOverride_bLowerHemisphereIsBlack = bOverride_bLowerHemisphereIsBlack;
 			bCacheOverride_LowerHemisphereColor = bOverride_LowerHemisphereColor;
+			bCacheOverride_bAffectsWorld = bOverride_bAffectsWorld;
+			bCacheOverride_CubemapResolution = bOverride_CubemapResolution;
+			bCacheOverride_bRealTimeCaptureTimeSliced = bOverride_bRealTimeCaptureTimeSliced;
 		}
 	}
 	Super::PreEditChange(PropertyAboutToChange);
@@ -300,6 +493,27 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
 	const FName MemberPropertyName = PropertyChangedEvent.GetMemberPropertyName();
 
+	// While a slider is dragged, only the parameters updated without a new capture follow it, at a capped rate.
+	// Everything invalidating the capture waits for the committed value, recapturing once.
+	if (PropertyChangedEvent.ChangeType == EPropertyChangeType::Interactive && !IsCaptureFreeProperty(PropertyName))
+	{
+		return;
+	}
+	if (!ShouldApplyInteractiveEdit(PropertyChangedEvent))
+	{
+		return;
+	}
+
+	// The Sky Lights are written directly below, a running transition would overwrite the edit.
+	if (bViewPointInVolume && SkyLight.IsValid())
+	{
+		SettleLightTransitions(SkyLight->GetLightComponent());
+	}
+	if (bViewPointInVolume && CacheSkyLight.IsValid())
+	{
+		SettleLightTransitions(CacheSkyLight->GetLightComponent());
+	}
+
 	if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, SkyLight))
 	{
 		if (bViewPointInVolume && CacheSkyLight != SkyLight)
@@ -311,7 +525,7 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 				{
 					if (bCacheRealTimeCapture != bRealTimeCapture)
 					{
-						CacheSkyLight->GetLightComponent()->SetRealTimeCapture(bCacheRealTimeCapture);
+						SetRealTimeCapture(this, CacheSkyLight->GetLightComponent(), bCacheRealTimeCapture);
 					}
 				}
 				if (bOverride_SourceType)
@@ -320,14 +534,14 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					{
 						CacheSkyLight->GetLightComponent()->SourceType = CacheSourceType;
 						CacheSkyLight->GetLightComponent()->MarkRenderStateDirty();
-						CacheSkyLight->GetLightComponent()->SetCaptureIsDirty();
+						RequestSkyCapture(this, CacheSkyLight->GetLightComponent());
 					}
 				}
 				if (bOverride_Cubemap)
 				{
 					if (CacheCubemap != Cubemap)
 					{
-						CacheSkyLight->GetLightComponent()->SetCubemap(CacheCubemap);
+						SetCubemap(this, CacheSkyLight->GetLightComponent(), CacheCubemap);
 					}
 				}
 				if (bOverride_Intensity)
@@ -362,7 +576,7 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 				{
 					if (bCacheLowerHemisphereIsBlack != bLowerHemisphereIsBlack)
 					{
-						SetLowerHemisphereIsBlack(CacheSkyLight->GetLightComponent(), bCacheLowerHemisphereIsBlack);
+						SetLowerHemisphereIsBlack(this, CacheSkyLight->GetLightComponent(), bCacheLowerHemisphereIsBlack);
 					}
 				}
 				if (bOverride_LowerHemisphereColor)
@@ -372,6 +586,27 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 						CacheSkyLight->GetLightComponent()->SetLowerHemisphereColor(CacheLowerHemisphereColor);
 					}
 				}
+				if (bOverride_bAffectsWorld)
+				{
+					if (bCacheAffectsWorld != bAffectsWorld)
+					{
+						CacheSkyLight->GetLightComponent()->bAffectsWorld = bCacheAffectsWorld;
+						CacheSkyLight->GetLightComponent()->MarkRenderStateDirty();
+					}
+				}
+				if (bOverride_CubemapResolution)
+				{
+					if (CacheCubemapResolution != CubemapResolution)
+					{
+						CacheSkyLight->GetLightComponent()->CubemapResolution = CacheCubemapResolution;
+						CacheSkyLight->GetLightComponent()->MarkRenderStateDirty();
+						RequestSkyCapture(this, CacheSkyLight->GetLightComponent());
+					}
+				}
+				if (bOverride_bRealTimeCaptureTimeSliced)
+				{
+					PopRealTimeCaptureTimeSliced(this);
+				}
 			}
 			OverrideLighting();
 		}
@@ -389,11 +624,11 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					{
 						bCacheRealTimeCapture = SkyLight->GetLightComponent()->bRealTimeCapture;
 					}
-					SkyLight->GetLightComponent()->SetRealTimeCapture(bRealTimeCapture);
+					SetRealTimeCapture(this, SkyLight->GetLightComponent(), bRealTimeCapture);
 				}
 				else
 				{
-					SkyLight->GetLightComponent()->SetRealTimeCapture(bCacheRealTimeCapture);
+					SetRealTimeCapture(this, SkyLight->GetLightComponent(), bCacheRealTimeCapture);
 				}
 			}
 		}
@@ -409,13 +644,13 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					}
 					SkyLight->GetLightComponent()->SourceType = SourceType;
 					SkyLight->GetLightComponent()->MarkRenderStateDirty();
-					SkyLight->GetLightComponent()->SetCaptureIsDirty();
+					RequestSkyCapture(this, SkyLight->GetLightComponent());
 				}
 				else
 				{
 					SkyLight->GetLightComponent()->SourceType = CacheSourceType;
 					SkyLight->GetLightComponent()->MarkRenderStateDirty();
-					SkyLight->GetLightComponent()->SetCaptureIsDirty();
+					RequestSkyCapture(this, SkyLight->GetLightComponent());
 				}
 			}
 		}
@@ -429,11 +664,11 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					{
 						CacheCubemap = SkyLight->GetLightComponent()->Cubemap;
 					}
-					SkyLight->GetLightComponent()->SetCubemap(Cubemap);
+					SetCubemap(this, SkyLight->GetLightComponent(), Cubemap);
 				}
 				else
 				{
-					SkyLight->GetLightComponent()->SetCubemap(CacheCubemap);
+					SetCubemap(this, SkyLight->GetLightComponent(), CacheCubemap);
 				}
 			}
 		}
@@ -483,11 +718,11 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					{
 						CacheIndirectLightingIntensity = SkyLight->GetLightComponent()->IndirectLightingIntensity;
 					}
-					CacheSkyLight->GetLightComponent()->SetIndirectLightingIntensity(IndirectLightingIntensity);
+					SkyLight->GetLightComponent()->SetIndirectLightingIntensity(IndirectLightingIntensity);
 				}
 				else
 				{
-					CacheSkyLight->GetLightComponent()->SetIndirectLightingIntensity(CacheIndirectLightingIntensity);
+					SkyLight->GetLightComponent()->SetIndirectLightingIntensity(CacheIndirectLightingIntensity);
 				}
 			}
 		}
@@ -501,11 +736,11 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					{
 						CacheVolumetricScatteringIntensity = SkyLight->GetLightComponent()->VolumetricScatteringIntensity;
 					}
-					CacheSkyLight->GetLightComponent()->SetVolumetricScatteringIntensity(VolumetricScatteringIntensity);
+					SkyLight->GetLightComponent()->SetVolumetricScatteringIntensity(VolumetricScatteringIntensity);
 				}
 				else
 				{
-					CacheSkyLight->GetLightComponent()->SetVolumetricScatteringIntensity(CacheVolumetricScatteringIntensity);
+					SkyLight->GetLightComponent()->SetVolumetricScatteringIntensity(CacheVolumetricScatteringIntensity);
 				}
 			}
 		}
@@ -519,11 +754,11 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 					{
 						bCacheLowerHemisphereIsBlack = SkyLight->GetLightComponent()->bLowerHemisphereIsBlack;
 					}
-					SetLowerHemisphereIsBlack(SkyLight->GetLightComponent(), bLowerHemisphereIsBlack);
+					SetLowerHemisphereIsBlack(this, SkyLight->GetLightComponent(), bLowerHemisphereIsBlack);
 				}
 				else
 				{
-					SetLowerHemisphereIsBlack(SkyLight->GetLightComponent(), bCacheLowerHemisphereIsBlack);
+					SetLowerHemisphereIsBlack(this, SkyLight->GetLightComponent(), bCacheLowerHemisphereIsBlack);
 				}
 			}
 		}
@@ -545,6 +780,62 @@ void ALocalSkyLightVolume::PostEditChangeProperty(FPropertyChangedEvent& Propert
 				}
 			}
 		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bAffectsWorld))
+		{
+			if (SkyLight.IsValid())
+			{
+				if (bOverride_bAffectsWorld)
+				{
+					if (bOverride_bAffectsWorld != bCacheOverride_bAffectsWorld)
+					{
+						bCacheAffectsWorld = SkyLight->GetLightComponent()->bAffectsWorld;
+					}
+					SkyLight->GetLightComponent()->bAffectsWorld = bAffectsWorld;
+					SkyLight->GetLightComponent()->MarkRenderStateDirty();
+				}
+				else
+				{
+					SkyLight->GetLightComponent()->bAffectsWorld = bCacheAffectsWorld;
+					SkyLight->GetLightComponent()->MarkRenderStateDirty();
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, CubemapResolution))
+		{
+			if (SkyLight.IsValid())
+			{
+				if (bOverride_CubemapResolution)
+				{
+					if (bOverride_CubemapResolution != bCacheOverride_CubemapResolution)
+					{
+						CacheCubemapResolution = SkyLight->GetLightComponent()->CubemapResolution;
+					}
+					SkyLight->GetLightComponent()->CubemapResolution = CubemapResolution;
+					SkyLight->GetLightComponent()->MarkRenderStateDirty();
+					RequestSkyCapture(this, SkyLight->GetLightComponent());
+				}
+				else
+				{
+					SkyLight->GetLightComponent()->CubemapResolution = CacheCubemapResolution;
+					SkyLight->GetLightComponent()->MarkRenderStateDirty();
+					RequestSkyCapture(this, SkyLight->GetLightComponent());
+				}
+			}
+		}
+		else if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bRealTimeCaptureTimeSliced))
+		{
+			if (SkyLight.IsValid())
+			{
+				if (bOverride_bRealTimeCaptureTimeSliced)
+				{
+					PushRealTimeCaptureTimeSliced(this, bRealTimeCaptureTimeSliced);
+				}
+				else
+				{
+					PopRealTimeCaptureTimeSliced(this);
+				}
+			}
+		}
 	}
 }
 
@@ -559,7 +850,10 @@ bool ALocalSkyLightVolume::CanEditChange(const FProperty* InProperty) const
 		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, IndirectLightingIntensity) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, VolumetricScatteringIntensity) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bLowerHemisphereIsBlack) ||
-		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, LowerHemisphereColor))
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, LowerHemisphereColor) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bAffectsWorld) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, CubemapResolution) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalSkyLightVolume, bRealTimeCaptureTimeSliced))
 	{
 		return SkyLight.IsValid();
 	}
@@ -0,0 +1,169 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalVolumetricCloudVolume.h"
+
+// Engine Include
+#include "Components/BrushComponent.h"
+#include "Components/VolumetricCloudComponent.h"
+
+static UVolumetricCloudComponent* GetVolumetricCloudComponent(AVolumetricCloud* VolumetricCloud)
+{
+	return VolumetricCloud->FindComponentByClass<UVolumetricCloudComponent>();
+}
+
+ALocalVolumetricCloudVolume::ALocalVolumetricCloudVolume()
+{
+	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+	GetBrushComponent()->Mobility = EComponentMobility::Movable;
+
+	bOverride_bVisible = false;
+	bOverride_ViewSampleCountScale = false;
+	bOverride_ShadowViewSampleCountScale = false;
+	bOverride_TracingMaxDistance = false;
+
+	VolumetricCloud = nullptr;
+	bVisible = true;
+	ViewSampleCountScale = 1.0f;
+	ShadowViewSampleCountScale = 1.0f;
+	TracingMaxDistance = 50.0f;
+
+	bCacheVisible = true;
+	CacheViewSampleCountScale = 1.0f;
+	CacheShadowViewSampleCountScale = 1.0f;
+	CacheTracingMaxDistance = 50.0f;
+}
+
+AActor* ALocalVolumetricCloudVolume::GetOverrideTarget() const
+{
+	return VolumetricCloud.Get();
+}
+
+void ALocalVolumetricCloudVolume::OverrideLighting()
+{
+	bOverridingLighting = false;
+	if (UVolumetricCloudComponent* Component = VolumetricCloud.IsValid() ? GetVolumetricCloudComponent(VolumetricCloud.Get()) : nullptr)
+	{
+		if (bOverride_bVisible)
+		{
+			bCacheVisible = Component->GetVisibleFlag();
+			if (bCacheVisible != bVisible)
+			{
+				Component->SetVisibility(bVisible);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_ViewSampleCountScale)
+		{
+			CacheViewSampleCountScale = Component->ViewSampleCountScale;
+			if (CacheViewSampleCountScale != ViewSampleCountScale)
+			{
+				Component->SetViewSampleCountScale(ViewSampleCountScale);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_ShadowViewSampleCountScale)
+		{
+			CacheShadowViewSampleCountScale = Component->ShadowViewSampleCountScale;
+			if (CacheShadowViewSampleCountScale != ShadowViewSampleCountScale)
+			{
+				Component->SetShadowViewSampleCountScale(ShadowViewSampleCountScale);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+		if (bOverride_TracingMaxDistance)
+		{
+			CacheTracingMaxDistance = Component->TracingMaxDistance;
+			if (CacheTracingMaxDistance != TracingMaxDistance)
+			{
+				Component->SetTracingMaxDistance(TracingMaxDistance);
+				RecordDebugMutation();
+				bOverridingLighting |= true;
+			}
+		}
+	}
+}
+
+void ALocalVolumetricCloudVolume::RestoreLighting()
+{
+	if (UVolumetricCloudComponent* Component = VolumetricCloud.IsValid() ? GetVolumetricCloudComponent(VolumetricCloud.Get()) : nullptr)
+	{
+		if (bOverride_bVisible)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, bVisible), bCacheVisible != bVisible))
+			{
+				Component->SetVisibility(bCacheVisible);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_ViewSampleCountScale)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, ViewSampleCountScale), CacheViewSampleCountScale != ViewSampleCountScale))
+			{
+				Component->SetViewSampleCountScale(CacheViewSampleCountScale);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_ShadowViewSampleCountScale)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, ShadowViewSampleCountScale), CacheShadowViewSampleCountScale != ShadowViewSampleCountScale))
+			{
+				Component->SetShadowViewSampleCountScale(CacheShadowViewSampleCountScale);
+				RecordDebugMutation();
+			}
+		}
+		if (bOverride_TracingMaxDistance)
+		{
+			if (ShouldRestoreOverride(GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, TracingMaxDistance), CacheTracingMaxDistance != TracingMaxDistance))
+			{
+				Component->SetTracingMaxDistance(CacheTracingMaxDistance);
+				RecordDebugMutation();
+			}
+		}
+	}
+	bOverridingLighting = false;
+}
+
+#if WITH_EDITOR
+void ALocalVolumetricCloudVolume::PreEditChange(FProperty* PropertyAboutToChange)
+{
+	// Undo the overrides while the cloud settings are unchanged, OverrideLighting caches the Component again after the edit.
+	if (bViewPointInVolume)
+	{
+		RestoreLighting();
+	}
+	Super::PreEditChange(PropertyAboutToChange);
+}
+
+void ALocalVolumetricCloudVolume::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (bViewPointInVolume)
+	{
+		OverrideLighting();
+	}
+}
+
+bool ALocalVolumetricCloudVolume::CanEditChange(const FProperty* InProperty) const
+{
+	const FName PropertyName = InProperty->GetFName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, bVisible) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, ViewSampleCountScale) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, ShadowViewSampleCountScale) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(ALocalVolumetricCloudVolume, TracingMaxDistance))
+	{
+		return VolumetricCloud.IsValid();
+	}
+
+	return Super::CanEditChange(InProperty);
+}
+#endif
@@ -0,0 +1,85 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Engine Include
+#include "Components/DirectionalLightComponent.h"
+#include "Engine/DirectionalLight.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+// Plugins Include
+#include "LocalDirectionalLightVolume.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Enable the override of the Volume and import its value, the overrides are only editable through reflection. */
+static void SetVolumeOverride(ALocalDirectionalLightVolume* Volume, FName PropertyName, const TCHAR* Value)
+{
+	const FProperty* OverrideProperty = Volume->GetClass()->FindPropertyByName(FName(*(TEXT("bOverride_") + PropertyName.ToString())));
+	const FProperty* ValueProperty = Volume->GetClass()->FindPropertyByName(PropertyName);
+	check(OverrideProperty && ValueProperty);
+	OverrideProperty->ImportText_InContainer(TEXT("True"), Volume, Volume, PPF_None);
+	ValueProperty->ImportText_InContainer(Value, Volume, Volume, PPF_None);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLocalDirectionalLightVolumeShadowOverridesTest, "LocalLightingVolume.DirectionalLight.ShadowOverrides",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FLocalDirectionalLightVolumeShadowOverridesTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	ADirectionalLight* DirectionalLight = World->SpawnActor<ADirectionalLight>();
+	UDirectionalLightComponent* Component = CastChecked<UDirectionalLightComponent>(DirectionalLight->GetLightComponent());
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetCastShadows(true);
+	Component->SetDynamicShadowDistanceMovableLight(20000.0f);
+	Component->SetDynamicShadowCascades(3);
+	Component->SetFarShadowCascadeCount(0);
+	Component->SetFarShadowDistance(300000.0f);
+	Component->ShadowResolutionScale = 1.0f;
+	Component->ContactShadowLength = 0.0f;
+
+	ALocalDirectionalLightVolume* Volume = World->SpawnActor<ALocalDirectionalLightVolume>();
+	CastFieldChecked<FWeakObjectProperty>(Volume->GetClass()->FindPropertyByName(TEXT("DirectionalLight")))->SetObjectPropertyValue_InContainer(Volume, DirectionalLight);
+	SetVolumeOverride(Volume, TEXT("CastShadows"), TEXT("False"));
+	SetVolumeOverride(Volume, TEXT("DynamicShadowDistanceMovableLight"), TEXT("5000.0"));
+	SetVolumeOverride(Volume, TEXT("DynamicShadowCascades"), TEXT("2"));
+	SetVolumeOverride(Volume, TEXT("FarShadowCascadeCount"), TEXT("4"));
+	SetVolumeOverride(Volume, TEXT("FarShadowDistance"), TEXT("100000.0"));
+	SetVolumeOverride(Volume, TEXT("ShadowResolutionScale"), TEXT("0.5"));
+	SetVolumeOverride(Volume, TEXT("ContactShadowLength"), TEXT("0.1"));
+
+	Volume->ForceEnter();
+	TestTrue(TEXT("Entering overrides lighting"), Volume->IsOverridingLighting());
+	TestEqual(TEXT("CastShadows overridden"), (bool)Component->CastShadows, false);
+	TestEqual(TEXT("DynamicShadowDistanceMovableLight overridden"), Component->DynamicShadowDistanceMovableLight, 5000.0f);
+	TestEqual(TEXT("DynamicShadowCascades overridden"), Component->DynamicShadowCascades, 2);
+	TestEqual(TEXT("FarShadowCascadeCount overridden"), Component->FarShadowCascadeCount, 4);
+	TestEqual(TEXT("FarShadowDistance overridden"), Component->FarShadowDistance, 100000.0f);
+	TestEqual(TEXT("ShadowResolutionScale overridden"), Component->ShadowResolutionScale, 0.5f);
+	TestEqual(TEXT("ContactShadowLength overridden"), Component->ContactShadowLength, 0.1f);
+
+	Volume->ForceExit();
+	TestFalse(TEXT("Exiting restores lighting"), Volume->IsOverridingLighting());
+	TestEqual(TEXT("CastShadows restored"), (bool)Component->CastShadows, true);
+	TestEqual(TEXT("DynamicShadowDistanceMovableLight restored"), Component->DynamicShadowDistanceMovableLight, 20000.0f);
+	TestEqual(TEXT("DynamicShadowCascades restored"), Component->DynamicShadowCascades, 3);
+	TestEqual(TEXT("FarShadowCascadeCount restored"), Component->FarShadowCascadeCount, 0);
+	TestEqual(TEXT("FarShadowDistance restored"), Component->FarShadowDistance, 300000.0f);
+	TestEqual(TEXT("ShadowResolutionScale restored"), Component->ShadowResolutionScale, 1.0f);
+	TestEqual(TEXT("ContactShadowLength restored"), Component->ContactShadowLength, 0.0f);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
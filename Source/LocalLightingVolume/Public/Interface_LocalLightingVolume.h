@@ -11,9 +11,128 @@
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
 
+// Plugins Include
+#include "LocalLightingShape.h"
+#include "LocalLightingTransitions.h"
+#include "LocalLightingVolumeDebug.h"
+
 // Generated Include
 #include "Interface_LocalLightingVolume.generated.h"
 
+class ULocalLightingVolumeInstancesComponent;
+class UTexture;
+
+/**
+ * Generational handle of a Volume registered in ULocalLightingSubsystem.
+ * A handle becomes stale as soon as its slot is released, even if the slot is reused by another Volume later.
+ */
+struct FLocalLightingVolumeHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const
+	{
+		return Index != INDEX_NONE;
+	}
+
+	void Invalidate()
+	{
+		Index = INDEX_NONE;
+		Generation = 0;
+	}
+
+	bool operator==(const FLocalLightingVolumeHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+
+	bool operator!=(const FLocalLightingVolumeHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+/**
+ * View settings resolved for a single View from the View overrides of the Volumes encompassing it.
+ * Resolved on the game thread as a scale and an offset of the post process settings of the View, which are only final on
+ * the render thread, and applied there leaving every light component untouched, so that split-screen and multiple viewports
+ * each get their own regional indirect lighting.
+ */
+struct FLocalLightingViewOverrides
+{
+	/** Scale of the indirect lighting intensity of the View. */
+	float IndirectLightingIntensityScale = 1.0f;
+	/** Added to the scaled indirect lighting intensity of the View. */
+	float IndirectLightingIntensityOffset = 0.0f;
+	/** Scale of the indirect lighting color of the View. */
+	FLinearColor IndirectLightingColorScale = FLinearColor::White;
+	/** Added to the scaled indirect lighting color of the View. */
+	FLinearColor IndirectLightingColorOffset = FLinearColor::Transparent;
+
+	/** Blend towards the given values, as blending the post process settings of the View would. */
+	void BlendIndirectLightingIntensity(float Value, float Weight)
+	{
+		IndirectLightingIntensityScale *= 1.0f - Weight;
+		IndirectLightingIntensityOffset = FMath::Lerp(IndirectLightingIntensityOffset, Value, Weight);
+	}
+	void BlendIndirectLightingColor(const FLinearColor& Value, float Weight)
+	{
+		IndirectLightingColorScale *= 1.0f - Weight;
+		IndirectLightingColorOffset = FMath::Lerp(IndirectLightingColorOffset, Value, Weight);
+	}
+
+	/** Apply to the post process settings of a View. */
+	void Apply(float& InOutIndirectLightingIntensity, FLinearColor& InOutIndirectLightingColor) const
+	{
+		InOutIndirectLightingIntensity = InOutIndirectLightingIntensity * IndirectLightingIntensityScale + IndirectLightingIntensityOffset;
+		InOutIndirectLightingColor = InOutIndirectLightingColor * IndirectLightingColorScale + IndirectLightingColorOffset;
+	}
+};
+
+UENUM()
+enum class ELocalLightingVolumeShape : uint8
+{
+	/** Containment is tested against the Brush, which requires the Brush Component to create its physics state. */
+	Brush,
+	/** Box of BoxExtent in Volume space, tested analytically without any physics state. */
+	Box,
+	/** Sphere of SphereRadius in Volume space, tested analytically without any physics state. */
+	Sphere,
+	/** Capsule along the Volume Z axis, tested analytically without any physics state. */
+	Capsule,
+};
+
+/** Scalability group whose quality level selects the override variant of a Volume. */
+UENUM()
+enum class ELocalLightingScalabilityGroup : uint8
+{
+	ViewDistance,
+	Shadow,
+	GlobalIllumination,
+	Reflection,
+	PostProcess,
+	Effects,
+};
+
+/** Overrides replacing those of a Volume at low quality levels of its scalability group. */
+USTRUCT(BlueprintType)
+struct FLocalLightingScalabilityVariant
+{
+	GENERATED_BODY()
+
+	/** Highest quality level of the scalability group this variant applies to, 0 being Low and 3 Epic. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability", meta = (ClampMin = "0", ClampMax = "4"))
+	int32 MaxQualityLevel = 0;
+
+	/**
+	 * Overrides by property name, as the text exported by the property, e.g. bRealTimeCapture = False.
+	 * A name enables its override, an empty value disables it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+	TMap<FName, FString> Overrides;
+};
+
 UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
 class UInterface_LocalLightingVolume : public UInterface
 {
@@ -27,6 +146,26 @@ class IInterface_LocalLightingVolume
 public:
 	virtual void Process(const FVector& ViewPoint) = 0;
 	virtual bool IsOverridingLighting() const = 0;
+	/** Whether the View Point is in the range of Volume, or of the parent of a linked Volume, processed until it leaves. */
+	virtual bool IsViewPointInVolume() const = 0;
+	/** World bounds of the range of Volume, the View Point can not enter the Volume outside of them. */
+	virtual FBox GetShapeBounds() const = 0;
+	virtual FLocalLightingVolumeHandle GetSubsystemHandle() const = 0;
+	virtual void SetSubsystemHandle(const FLocalLightingVolumeHandle& Handle) = 0;
+	/** Override lighting as if the View Point entered the Volume. */
+	virtual void ForceEnter() = 0;
+	/** Restore lighting as if the View Point left the Volume. */
+	virtual void ForceExit() = 0;
+	/** Apply the View overrides of this Volume to the settings of a View, without mutating any component. */
+	virtual void ResolveViewOverrides(const FVector& ViewPoint, FLocalLightingViewOverrides& InOutOverrides) const = 0;
+	/** Select the overrides matching the current scalability, called by ULocalLightingSubsystem when it changes. */
+	virtual void UpdateScalabilityVariant() = 0;
+#if WITH_EDITOR
+	/** Called by ULocalLightingSubsystem before the package owning this Volume is saved. */
+	virtual void OnOwningPackagePreSave() = 0;
+	/** Called by ULocalLightingSubsystem after the package owning this Volume is saved. */
+	virtual void OnOwningPackageSaved() = 0;
+#endif
 };
 
 UCLASS(Abstract, HideCategories = (Advanced, Collision, Volume, Brush, Attachment), MinimalAPI)
@@ -37,33 +176,284 @@ class ALocalLightingVolumeBase : public AVolume, public IInterface_LocalLighting
 protected:
 	bool bViewPointInVolume;
 	bool bOverridingLighting;
+	/** Overrides RestoreLighting writes back whatever the value of the target, while restoring a baseline, see RestoreBaseline. */
+	const TSet<FName>* RestoringBaselineNames;
+
+	/** Shape used to test whether the View Point is in the range of Volume. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volume Shape")
+	ELocalLightingVolumeShape Shape;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volume Shape", meta = (Units = "cm", EditCondition = "Shape == ELocalLightingVolumeShape::Box", EditConditionHides))
+	FVector BoxExtent;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volume Shape", meta = (UIMin = "0", Units = "cm", EditCondition = "Shape == ELocalLightingVolumeShape::Sphere", EditConditionHides))
+	float SphereRadius;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volume Shape", meta = (UIMin = "0", Units = "cm", EditCondition = "Shape == ELocalLightingVolumeShape::Capsule", EditConditionHides))
+	float CapsuleRadius;
+
+	/** Half height of the Capsule, including the hemispherical caps. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volume Shape", meta = (UIMin = "0", Units = "cm", EditCondition = "Shape == ELocalLightingVolumeShape::Capsule", EditConditionHides))
+	float CapsuleHalfHeight;
+
+	/** Time in seconds to blend from the current lighting to the overrides of this Volume and back, 0 switches instantly. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Transition", meta = (UIMin = "0", UIMax = "10", Units = "s"))
+	float TransitionDuration;
+
+	/**
+	 * Distance inside the boundary over which the overrides ramp in, so that one Volume replaces a stack of nested ones.
+	 * Only supported by the analytic shapes, a Brush always applies its overrides fully.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Transition", meta = (UIMin = "0", Units = "cm", EditCondition = "Shape != ELocalLightingVolumeShape::Brush"))
+	float BlendDistance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ViewIndirectLightingIntensity:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ViewIndirectLightingColor:1;
+
+	/**
+	 * Indirect lighting intensity of the Views in the range of Volume, replacing the one of their post process settings.
+	 * Only resolved per View with r.LocalLightingVolume.PerViewOverrides, which leaves every light component untouched.
+	 * Nested Volumes resolve from the largest to the smallest, the most local one winning.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "View", meta = (UIMin = "0", UIMax = "4", EditCondition = "bOverride_ViewIndirectLightingIntensity"))
+	float ViewIndirectLightingIntensity;
+
+	/** Indirect lighting color of the Views in the range of Volume, see ViewIndirectLightingIntensity. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "View", meta = (HideAlphaChannel, EditCondition = "bOverride_ViewIndirectLightingColor"))
+	FLinearColor ViewIndirectLightingColor;
+
+	/** Scalability group whose quality level selects one of ScalabilityVariants. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+	ELocalLightingScalabilityGroup ScalabilityGroup;
+
+	/**
+	 * Variants of the overrides for low quality levels, the one with the lowest MaxQualityLevel not under the current level applies.
+	 * The overrides of the Volume apply above every variant. Variants no device profile of a platform can select are stripped at cook.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Scalability")
+	TArray<FLocalLightingScalabilityVariant> ScalabilityVariants;
+
+	/**
+	 * Volumes applied together with this one, e.g. the moon, fog and sky of the region of a sun override.
+	 * Only this Volume is tested, the Shape of the linked Volumes is ignored and all their targets change in the same frame.
+	 * A linked Volume can not link Volumes itself.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Linked Volumes")
+	TArray<TObjectPtr<ALocalLightingVolumeBase>> LinkedVolumes;
+
+	/** Volume driving this one while linked, see LinkedVolumes. */
+	TWeakObjectPtr<ALocalLightingVolumeBase> LinkedParent;
+
+	/** Instances of the analytic Shape found on this Actor, replacing the single Shape when not empty. */
+	UPROPERTY(Transient)
+	TObjectPtr<ULocalLightingVolumeInstancesComponent> InstancesComponent;
+
+	/** Weight of the overrides at the View Point, ramping from 0 on the boundary to 1 at BlendDistance inside. */
+	float BlendWeight;
+
+#if WITH_EDITORONLY_DATA
+	/** Real time an interactive change was last applied, see ShouldApplyInteractiveEdit. */
+	double LastInteractiveEditTime;
+#endif
+
+	/** Handle of this Volume in ULocalLightingSubsystem, invalid while unregistered. */
+	FLocalLightingVolumeHandle SubsystemHandle;
+
+	/** Order in which the View Point entered this Volume, so that a snapshot enters the Volumes again in the same order. */
+	uint32 EnterOrder;
+
+	/** Index of the applied variant of ScalabilityVariants, INDEX_NONE while the overrides of the Volume apply. */
+	int32 ScalabilityVariantIndex;
+
+	/** Authored text of the properties replaced by the applied variant, restored before another one applies. */
+	TMap<FName, FString> ScalabilityAuthoredValues;
+
+#if ENABLE_DRAW_DEBUG
+	FLocalLightingVolumeDebugCounters DebugCounters;
+#endif
 
 public:
 	ALocalLightingVolumeBase();
 
 	//~ Begin AActor Interface
+	virtual void PreRegisterAllComponents() override;
 	virtual void PostRegisterAllComponents() override;
 	virtual void PostUnregisterAllComponents() override;
 	//~ End AActor Interface
 
+	//~ Begin UObject Interface
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+#if WITH_EDITOR
+	virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject Interface
+
 	//~ Begin IInterface_LocalLightingVolume Interface
 	virtual void Process(const FVector& ViewPoint) override;
 	virtual bool IsOverridingLighting() const override;
+	virtual bool IsViewPointInVolume() const override;
+	virtual FBox GetShapeBounds() const override;
+	virtual FLocalLightingVolumeHandle GetSubsystemHandle() const override;
+	virtual void SetSubsystemHandle(const FLocalLightingVolumeHandle& Handle) override;
+	virtual void ForceEnter() override;
+	virtual void ForceExit() override;
+	virtual void ResolveViewOverrides(const FVector& ViewPoint, FLocalLightingViewOverrides& InOutOverrides) const override;
+	virtual void UpdateScalabilityVariant() override;
+#if WITH_EDITOR
+	virtual void OnOwningPackagePreSave() override;
+	virtual void OnOwningPackageSaved() override;
+#endif
 	//~ End IInterface_LocalLightingVolume Interface
 
+	/** Whether the View Point is in the range of Volume, according to its Shape. */
+	bool EncompassesViewPoint(const FVector& ViewPoint) const;
+
+	/** Weight of the overrides for a View Point in the range of Volume, see BlendDistance. */
+	float GetBlendWeight(const FVector& ViewPoint) const;
+
+	/** Textures referenced by the overrides, reported apart from the resource size since they are shared assets. */
+	virtual void GetReferencedTextures(TArray<UTexture*>& OutTextures) const {}
+
+	ELocalLightingVolumeShape GetShape() const { return Shape; }
+
+	/** Actor whose components are overridden, nullptr when the overrides are global. */
+	virtual AActor* GetOverrideTarget() const { return nullptr; }
+
+	/**
+	 * Enabled overrides by property name, exported as text, so that Volumes can be compared without knowing their class.
+	 * Gathers every bOverride_X toggle set along with its X property.
+	 */
+	virtual void GetOverridePayload(TMap<FName, FString>& OutPayload) const;
+
+	/**
+	 * Values restored when the View Point leaves the Volume, by the name of their override, exported as text.
+	 * Gathers the transient CacheX property of every enabled override.
+	 */
+	void GetCachePayload(TMap<FName, FString>& OutPayload) const;
+
+	/**
+	 * Write the baseline values of the overrides of this Volume back to its target, while the View Point is not in the Volume.
+	 * The restored values are removed from InOutBaselineValues, so that another Volume of the same target restores the others.
+	 */
+	void RestoreBaseline(TMap<FName, FString>& InOutBaselineValues);
+
+	/** Override lighting at the given weight as if the View Point entered the Volume, see ForceEnter. */
+	void ForceEnterWithBlendWeight(float InBlendWeight);
+
+	/** Weight of the overrides last applied, see BlendDistance. */
+	float GetAppliedBlendWeight() const;
+
+	uint32 GetEnterOrder() const;
+
+	/** Refresh the bounds ULocalLightingSubsystem filters this Volume with, called whenever the range of Volume moves. */
+	void UpdateSubsystemBounds();
+
+	/** Whether this Volume or one of its linked Volumes sets a View override, see ResolveViewOverrides. */
+	bool HasViewOverrides() const;
+
+	/** Whether entering or leaving the Volume invalidates a Sky Light capture. */
+	virtual bool TriggersSkyRecapture() const { return false; }
+
+	const TArray<TObjectPtr<ALocalLightingVolumeBase>>& GetLinkedVolumes() const;
+
+#if ENABLE_DRAW_DEBUG
+	FLocalLightingVolumeDebugCounters& GetDebugCounters();
+#endif
+
+	/** Count a write to a target in DebugCounters, for the writes not going through BlendLightProperty. */
+	void RecordDebugMutation() const;
+
+	/** Whether Other applies exactly the same overrides with the same Shape settings, so that both ranges can be one Volume. */
+	bool CanMergeWith(const ALocalLightingVolumeBase* Other) const;
+
+#if WITH_EDITOR
+	/**
+	 * Extend the range of this Volume with the range of Other, which is left to be destroyed by the caller.
+	 * A Brush appends the convex elements and polygons of Other, an analytic Shape adds Other as an instance.
+	 */
+	bool MergeVolume(ALocalLightingVolumeBase* Other);
+#endif
+
 protected:
+	/** Distance from the local View Point to the boundary of the analytic Shape, negative outside. */
+	float GetLocalDepth(const FVector& LocalViewPoint) const;
+
+	/** Extent of the bounding box of the analytic Shape, in Volume space. */
+	FVector GetLocalShapeExtent() const;
+
+	/** Analytic Shape evaluated by LocalLightingVolumeCore, a Box for the Brush shape. */
+	FLocalLightingShape GetAnalyticShape() const;
+
 	virtual void OverrideLighting() {}
 	virtual void RestoreLighting() {}
+	/** Apply the View overrides of this Volume alone at the given weight, see ResolveViewOverrides. */
+	void ApplyViewOverrides(float ViewBlendWeight, FLocalLightingViewOverrides& InOutOverrides) const;
+	/** Called while overriding lighting when BlendWeight changed, to blend the overrides towards their new weighted values. */
+	virtual void UpdateBlendWeight() {}
+
+	float ApplyBlendWeight(float CacheValue, float Value) const;
+	FLinearColor ApplyBlendWeight(const FLinearColor& CacheValue, const FLinearColor& Value) const;
+	FRotator ApplyBlendWeight(const FRotator& CacheValue, const FRotator& Value) const;
 
-public:
 #if WITH_EDITOR
-	FDelegateHandle PreSaveHandle;
-	FDelegateHandle SavedHandle;
-	virtual void OnOverridingLightComponentPackagePreSave(UPackage* Package, FObjectPreSaveContext Context);
-	virtual void OnOverridingLightComponentPackageSaved(const FString& FileName, UPackage* Package, FObjectPostSaveContext Context);
+	/**
+	 * Whether the change should be applied to the target now. Interactive changes, sent every tick while a slider is dragged,
+	 * are applied at most at r.LocalLightingVolume.Editor.InteractiveEditRate, the committed value always applies.
+	 */
+	bool ShouldApplyInteractiveEdit(const FPropertyChangedEvent& PropertyChangedEvent);
 #endif
 
+	/** Set the property of the light component, blended over TransitionDuration by ULocalLightingSubsystem. */
+	void BlendLightProperty(ULightComponentBase* Component, ELocalLightingBlendProperty Property, float Value) const;
+	void BlendLightProperty(ULightComponentBase* Component, const FLinearColor& LightColor) const;
+	void BlendLightProperty(ULightComponentBase* Component, const FRotator& Rotation) const;
+
+	/** Value the property of the light component settles to, so that a running transition is not cached halfway. */
+	float GetSettledLightProperty(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const;
+	FLinearColor GetSettledLightColor(const ULightComponentBase* Component) const;
+	FRotator GetSettledLightRotation(const ULightComponentBase* Component) const;
+
+	/** Land the running transitions of the light component on their targets, so that a direct write, e.g. from an edit, is not blended over. */
+	void SettleLightTransitions(ULightComponentBase* Component) const;
+
+	/**
+	 * Whether RestoreLighting writes the cached value of the override back to the target.
+	 * On leave only the overrides that changed the target are, while restoring a baseline exactly the overrides it holds are.
+	 */
+	bool ShouldRestoreOverride(FName OverrideName, bool bChanged) const;
+
 private:
+	void BlendLightValue(ULightComponentBase* Component, ELocalLightingBlendProperty Property, const FVector4& Value) const;
+	FVector4 GetSettledLightValue(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const;
+
+	/** Shape counted in the stats when registered, so that editing the Shape keeps the counters balanced. */
+	ELocalLightingVolumeShape StatsShape;
+	uint32 RegisterComponentsStartCycles;
+
+	/** Whether this Volume is evaluated by ULocalLightingSubsystem, linked Volumes are driven by their parent instead. */
+	bool bRegisteredIntoSubsystem;
+
 	void RegisterIntoSubsystem();
 	void UnregisterFromSubsystem();
+
+	FDelegateHandle RootTransformUpdatedHandle;
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Drive LinkedVolumes from this Volume, taking them out of ULocalLightingSubsystem. */
+	void LinkVolumes();
+	/** Restore LinkedVolumes and hand them back to ULocalLightingSubsystem. */
+	void UnlinkVolumes();
+	/** Enter, leave or reweight this linked Volume along with its parent. */
+	void SetLinkedState(bool bInVolume, float InBlendWeight);
+	void UpdateLinkedVolumes();
+
+	/** Count a transition in DebugCounters, mutations and sky recaptures are counted where they happen. */
+	void RecordDebugTransition();
+
+	/** Import the text into the property, keeping its authored text the first time it is replaced. */
+	void ImportScalabilityValue(FName PropertyName, const FString& Value);
 };
@@ -0,0 +1,57 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+
+// Plugins Include
+#include "LocalLightingOverrideStack.h"
+
+/**
+ * Process wide stacks of Console Variable overrides.
+ * Console Variables are global, so overrides from every Volume of every World are composed here:
+ * the most recently pushed override wins, and the value seen before the first override is restored once the last one is popped,
+ * no matter in which order the owners leave.
+ * Overrides are set with the priority the Console Variable had before the first one, so that its priority is left as found
+ * and later scalability, device profile or ini changes still apply.
+ */
+class LOCALLIGHTINGVOLUME_API FLocalConsoleVariableOverrides
+{
+public:
+	static FLocalConsoleVariableOverrides& Get();
+
+	/** Returns false if the Console Variable does not exist or has been set from the command line, code or the console. */
+	bool Push(const UObject* Owner, const FString& Name, const FString& Value);
+
+	void Pop(const UObject* Owner, const FString& Name);
+
+	void PopAll(const UObject* Owner);
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FOverrideStack
+	{
+		IConsoleVariable* Variable = nullptr;
+		/** Value before the first override, floats are kept as is to restore them exactly. */
+		FString BaselineValue;
+		float BaselineFloatValue = 0.0f;
+		bool bBaselineIsFloat = false;
+		/** Priority the Console Variable was last set with before the first override. */
+		EConsoleVariableFlags SetBy = ECVF_SetByConstructor;
+		TLocalLightingOverrideStack<FObjectKey, FString> Overrides;
+	};
+
+	TMap<FString, FOverrideStack> Stacks;
+
+	/** Returns true once the last override is removed and the baseline value is restored. */
+	bool RemoveOverride(FOverrideStack& Stack, const UObject* Owner);
+};
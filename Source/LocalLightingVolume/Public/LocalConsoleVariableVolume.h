@@ -0,0 +1,76 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+
+// Generated Include
+#include "LocalConsoleVariableVolume.generated.h"
+
+USTRUCT(BlueprintType)
+struct FLocalConsoleVariableOverride
+{
+	GENERATED_BODY()
+
+	/** Name of the Console Variable, e.g. r.VolumetricFog. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Console Variables")
+	FString Name;
+
+	/** Value applied while View Point in the range of Volume. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Console Variables")
+	FString Value;
+};
+
+/**
+ * Allow to modify Console Variables when View Point in the range of Volume.
+ * Overrides are applied with code priority, nested Volumes overriding the same Console Variable are composed,
+ * and the exact previous value is restored once the View Point leaves every one of them.
+ */
+UCLASS(AutoExpandCategories = ("Console Variables"), MinimalAPI)
+class ALocalConsoleVariableVolume : public ALocalLightingVolumeBase
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Console Variables")
+	TArray<FLocalConsoleVariableOverride> ConsoleVariables;
+
+public:
+	ALocalConsoleVariableVolume();
+
+	//~ Begin AActor Interface
+	virtual void PostUnregisterAllComponents() override;
+	//~ End AActor Interface
+
+	//~ Begin UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	//~ End UObject Interface
+
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual void GetOverridePayload(TMap<FName, FString>& OutPayload) const override;
+	//~ End ALocalLightingVolumeBase Interface
+
+protected:
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual void OverrideLighting() override;
+	virtual void RestoreLighting() override;
+	//~ End ALocalLightingVolumeBase Interface
+
+public:
+    //~ Begin UObject Interface
+#if WITH_EDITOR
+	virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif // WITH_EDITOR
+    //~ End UObject Interface
+};
@@ -36,6 +36,20 @@ protected:
 	uint8 bOverride_IndirectLightingIntensity:1;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
 	uint8 bOverride_VolumetricScatteringIntensity:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_CastShadows:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_DynamicShadowDistanceMovableLight:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_DynamicShadowCascades:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_FarShadowCascadeCount:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_FarShadowDistance:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ShadowResolutionScale:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ContactShadowLength:1;
 
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -72,11 +86,75 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, interp, Category = "Directional Light", meta=(UIMin = "0.25", UIMax = "4.0", EditCondition = "bOverride_VolumetricScatteringIntensity"))
 	float VolumetricScatteringIntensity;
 
+	/**
+	 * Whether the light should cast any shadows.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (EditCondition = "bOverride_CastShadows"))
+	bool CastShadows;
+
+	/** 
+	 * How far Cascaded Shadow Map dynamic shadows will cover for a movable light, measured from the camera.
+	 * A value of 0 disables the dynamic shadow.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (DisplayName = "Dynamic Shadow Distance MovableLight", UIMin = "0", UIMax = "20000", Units = "cm", EditCondition = "bOverride_DynamicShadowDistanceMovableLight"))
+	float DynamicShadowDistanceMovableLight;
+
+	/** 
+	 * Number of cascades to split the view frustum into for the whole scene dynamic shadow.
+	 * More cascades result in better shadow resolution, but adds significant rendering cost.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (DisplayName = "Num Dynamic Shadow Cascades", UIMin = "0", UIMax = "10", EditCondition = "bOverride_DynamicShadowCascades"))
+	int32 DynamicShadowCascades;
+
+	/** 
+	 * Number of cascades to split the view frustum into for the far shadow distance.
+	 * A value of 0 disables the far shadow cascades.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (UIMin = "0", UIMax = "10", EditCondition = "bOverride_FarShadowCascadeCount"))
+	int32 FarShadowCascadeCount;
+
+	/** 
+	 * Distance at which the far shadow cascade should end.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (UIMin = "0", UIMax = "800000", Units = "cm", EditCondition = "bOverride_FarShadowDistance"))
+	float FarShadowDistance;
+
+	/** 
+	 * Scales the resolution of shadowmaps used to shadow this light.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (UIMin = ".125", UIMax = "8", EditCondition = "bOverride_ShadowResolutionScale"))
+	float ShadowResolutionScale;
+
+	/** 
+	 * Length of screen space ray trace for sharp contact shadows. Zero is disabled.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Directional Light|Shadows", meta = (UIMin = "0", UIMax = "1.0", EditCondition = "bOverride_ContactShadowLength"))
+	float ContactShadowLength;
+
+	UPROPERTY(Transient)
 	FRotator CacheRotation;
+	UPROPERTY(Transient)
 	float CacheIntensity;
+	UPROPERTY(Transient)
 	FColor CacheLightColor;
+	UPROPERTY(Transient)
 	float CacheIndirectLightingIntensity;
+	UPROPERTY(Transient)
 	float CacheVolumetricScatteringIntensity;
+	UPROPERTY(Transient)
+	bool bCacheCastShadows;
+	UPROPERTY(Transient)
+	float CacheDynamicShadowDistanceMovableLight;
+	UPROPERTY(Transient)
+	int32 CacheDynamicShadowCascades;
+	UPROPERTY(Transient)
+	int32 CacheFarShadowCascadeCount;
+	UPROPERTY(Transient)
+	float CacheFarShadowDistance;
+	UPROPERTY(Transient)
+	float CacheShadowResolutionScale;
+	UPROPERTY(Transient)
+	float CacheContactShadowLength;
 
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Transient)
@@ -86,15 +164,27 @@ protected:
 	uint8 bCacheOverride_LightColor:1;
 	uint8 bCacheOverride_IndirectLightingIntensity:1;
 	uint8 bCacheOverride_VolumetricScatteringIntensity:1;
+	uint8 bCacheOverride_CastShadows:1;
+	uint8 bCacheOverride_DynamicShadowDistanceMovableLight:1;
+	uint8 bCacheOverride_DynamicShadowCascades:1;
+	uint8 bCacheOverride_FarShadowCascadeCount:1;
+	uint8 bCacheOverride_FarShadowDistance:1;
+	uint8 bCacheOverride_ShadowResolutionScale:1;
+	uint8 bCacheOverride_ContactShadowLength:1;
 #endif
 
 public:
 	ALocalDirectionalLightVolume();
 
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual AActor* GetOverrideTarget() const override;
+	//~ End ALocalLightingVolumeBase Interface
+
 protected:
 	//~ Begin ALocalLightingVolumeBase Interface
 	virtual void OverrideLighting() override;
 	virtual void RestoreLighting() override;
+	virtual void UpdateBlendWeight() override;
 	//~ End ALocalLightingVolumeBase Interface
 
 public:
@@ -0,0 +1,97 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+
+// Generated Include
+#include "LocalExponentialHeightFogVolume.generated.h"
+
+/**
+ * Allow to modify Exponential Height Fog when View Point in the range of Volume.
+ */
+UCLASS(AutoExpandCategories = ("Exponential Height Fog"), MinimalAPI)
+class ALocalExponentialHeightFogVolume : public ALocalLightingVolumeBase
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bVisible:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_FogDensity:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bEnableVolumetricFog:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_VolumetricFogDistance:1;
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Exponential Height Fog")
+	TWeakObjectPtr<class AExponentialHeightFog> ExponentialHeightFog;
+
+	/**
+	 * Whether the fog is rendered at all, its Volumetric fog included.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Exponential Height Fog", meta = (DisplayName = "Visible", EditCondition = "bOverride_bVisible"))
+	bool bVisible;
+
+	/** Global density factor. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Exponential Height Fog", meta = (UIMin = "0", UIMax = ".05", EditCondition = "bOverride_FogDensity"))
+	float FogDensity;
+
+	/**
+	 * Whether to use Volumetric fog.
+	 * Volumetric fog is one of the most expensive features of the fog, disabling it where it can not be seen saves its whole cost.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Exponential Height Fog", meta = (DisplayName = "Volumetric Fog", EditCondition = "bOverride_bEnableVolumetricFog"))
+	bool bEnableVolumetricFog;
+
+	/**
+	 * Distance over which volumetric fog should be computed, after the start distance.
+	 * Larger values extend the effect into the distance but expose under-sampling artifacts in details.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Exponential Height Fog", meta = (UIMin = "1000", UIMax = "10000", Units = "cm", EditCondition = "bOverride_VolumetricFogDistance"))
+	float VolumetricFogDistance;
+
+	UPROPERTY(Transient)
+	bool bCacheVisible;
+	UPROPERTY(Transient)
+	float CacheFogDensity;
+	UPROPERTY(Transient)
+	bool bCacheEnableVolumetricFog;
+	UPROPERTY(Transient)
+	float CacheVolumetricFogDistance;
+
+public:
+	ALocalExponentialHeightFogVolume();
+
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual AActor* GetOverrideTarget() const override;
+	//~ End ALocalLightingVolumeBase Interface
+
+protected:
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual void OverrideLighting() override;
+	virtual void RestoreLighting() override;
+	//~ End ALocalLightingVolumeBase Interface
+
+public:
+    //~ Begin UObject Interface
+#if WITH_EDITOR
+	virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual bool CanEditChange(const FProperty* InProperty) const override;
+#endif // WITH_EDITOR
+    //~ End UObject Interface
+};
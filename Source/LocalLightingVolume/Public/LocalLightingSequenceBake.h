@@ -0,0 +1,74 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPath.h"
+
+// Generated Include
+#include "LocalLightingSequenceBake.generated.h"
+
+class ULevelSequence;
+
+USTRUCT()
+struct FLocalLightingBakedKey
+{
+	GENERATED_BODY()
+
+	/** Time of the Level Sequence Player in seconds. */
+	UPROPERTY(VisibleAnywhere, Category = "Baked Keys")
+	double Time = 0.0;
+
+	/** Volumes encompassing the camera from Time until the next key, without PIE prefix. */
+	UPROPERTY(VisibleAnywhere, Category = "Baked Keys")
+	TArray<FSoftObjectPath> ActiveVolumes;
+
+	/** Whether the key starts a camera cut, where running transitions are settled instead of blended across the cut. */
+	UPROPERTY(VisibleAnywhere, Category = "Baked Keys")
+	bool bCameraCut = false;
+};
+
+/**
+ * Volume state resolved along the camera cuts of a Level Sequence.
+ * While played by ULocalLightingSubsystem, Volumes are entered and exited from the keys without testing any containment.
+ * Only the active Volumes are baked, the light values are still applied by the Volumes themselves during playback.
+ */
+UCLASS(BlueprintType)
+class LOCALLIGHTINGVOLUME_API ULocalLightingSequenceBake : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Sequence")
+	TSoftObjectPtr<ULevelSequence> Sequence;
+
+	/** Sample every Nth display rate frame of the Sequence, camera cuts are always sampled. */
+	UPROPERTY(EditAnywhere, Category = "Sequence", meta = (ClampMin = "1"))
+	int32 SampleInterval = 1;
+
+	/** Keys sorted by time, only added when the active Volumes change or a camera cut starts. */
+	UPROPERTY(VisibleAnywhere, Category = "Baked Keys")
+	TArray<FLocalLightingBakedKey> Keys;
+
+	/** Index of the key in effect at the given time, INDEX_NONE before the first key. */
+	int32 FindKey(double Time) const;
+
+#if WITH_EDITOR
+	/**
+	 * Play the Sequence in the given World and record the Volumes encompassing its camera.
+	 * The state of the actors animated by the Sequence is restored once baked.
+	 */
+	bool Bake(UWorld* World);
+
+	/** Bake the Sequence in the World opened in the editor. */
+	UFUNCTION(CallInEditor, Category = "Sequence")
+	void BakeInEditorWorld();
+#endif
+};
@@ -0,0 +1,61 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+// Generated Include
+#include "LocalLightingSnapshot.generated.h"
+
+USTRUCT(BlueprintType)
+struct FLocalLightingVolumeSnapshot
+{
+	GENERATED_BODY()
+
+	/** Volume the View Point is in, without PIE prefix. */
+	UPROPERTY(VisibleAnywhere, SaveGame, Category = "Snapshot")
+	FSoftObjectPath Volume;
+
+	/** Weight of the overrides of the Volume, see ALocalLightingVolumeBase::BlendDistance. */
+	UPROPERTY(VisibleAnywhere, SaveGame, Category = "Snapshot")
+	float BlendWeight = 1.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FLocalLightingTargetSnapshot
+{
+	GENERATED_BODY()
+
+	/** Actor overridden by the Volumes without PIE prefix, empty for the global overrides such as console variables. */
+	UPROPERTY(VisibleAnywhere, SaveGame, Category = "Snapshot")
+	FSoftObjectPath Target;
+
+	/** Values of the overridden properties before any Volume applied, by the name of their override, as exported text. */
+	UPROPERTY(VisibleAnywhere, SaveGame, Category = "Snapshot")
+	TMap<FName, FString> BaselineValues;
+};
+
+/**
+ * Resolved lighting state of a World, captured and applied by ULocalLightingSubsystem.
+ * Only paths and exported text are kept, so that a snapshot can be stored in a save game and applied to a freshly loaded World.
+ */
+USTRUCT(BlueprintType)
+struct FLocalLightingSnapshot
+{
+	GENERATED_BODY()
+
+	/** Volumes the View Point is in, in the order they were entered. Linked Volumes follow their parent and are not listed. */
+	UPROPERTY(VisibleAnywhere, SaveGame, Category = "Snapshot")
+	TArray<FLocalLightingVolumeSnapshot> Volumes;
+
+	/** Every Actor overridden by the active Volumes, including their linked Volumes. */
+	UPROPERTY(VisibleAnywhere, SaveGame, Category = "Snapshot")
+	TArray<FLocalLightingTargetSnapshot> Targets;
+};
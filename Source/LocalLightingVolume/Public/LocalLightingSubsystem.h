@@ -9,22 +9,146 @@
 
 // Engine Include
 #include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "HAL/IConsoleManager.h"
+#include "Scalability.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakInterfacePtr.h"
 
 // Plugins Include
 #include "Interface_LocalLightingVolume.h"
+#include "LocalLightingCandidateFilter.h"
+#include "LocalLightingSnapshot.h"
+#include "LocalLightingTransitions.h"
 
 // Generated Include
 #include "LocalLightingSubsystem.generated.h"
 
+class FObjectPreSaveContext;
+class FObjectPostSaveContext;
+class ULevelSequencePlayer;
+class ULocalLightingSequenceBake;
+class USkyLightComponent;
+
+/**
+ * Provides the View Point evaluated by the scheduler of ULocalLightingSubsystem.
+ * Returns false when no View Point is available this frame, e.g. before the player is spawned.
+ */
+DECLARE_DELEGATE_RetVal_OneParam(bool, FLocalLightingViewPointProvider, FVector& /*OutViewPoint*/);
+
 UCLASS(NotBlueprintable)
 class LOCALLIGHTINGVOLUME_API ULocalLightingSubsystem : public UWorldSubsystem
 {
 	GENERATED_BODY()
 
 protected:
-	UPROPERTY()
-	TArray<TScriptInterface<IInterface_LocalLightingVolume>> Volumes;
+	struct FVolumeSlot
+	{
+		/** Index of the Volume in the dense arrays, INDEX_NONE while the slot is free. */
+		int32 DenseIndex = INDEX_NONE;
+		/** Bumped every time the slot is released so that stale handles are rejected. */
+		uint32 Generation = 1;
+	};
+
+	/** Sparse handle table, addressed by FLocalLightingVolumeHandle::Index. */
+	TArray<FVolumeSlot> Slots;
+
+	/** Released slots ready to be reused. */
+	TArray<int32> FreeSlots;
+
+	/**
+	 * Densely packed registered Volumes, iterated every evaluation.
+	 * Volumes are owned by their Level, so they are only referenced weakly here.
+	 */
+	TArray<TWeakInterfacePtr<IInterface_LocalLightingVolume>> Volumes;
+
+	/** Slot of each dense Volume, used to patch the handle table on swap-remove. */
+	TArray<int32> VolumeSlots;
+
+	/** World bounds of each dense Volume, only the Volumes whose bounds contain the View Point test their exact Shape. */
+	FLocalLightingCandidateFilter CandidateFilter;
+
+	struct FPendingVolumeOperation
+	{
+		TWeakInterfacePtr<IInterface_LocalLightingVolume> Volume;
+		bool bRegister = false;
+	};
+
+	/**
+	 * Registrations and unregistrations pushed from any thread, e.g. while World Partition streams cells in and out.
+	 * The queue is flushed once per frame on the game thread, applying every structural change in one batch.
+	 * Handles are only read and written by the flush.
+	 */
+	TQueue<FPendingVolumeOperation, EQueueMode::Mpsc> PendingOperations;
+
+#if WITH_EDITORONLY_DATA
+	/** Outermost package of each dense Volume. */
+	TArray<TObjectKey<UPackage>> VolumePackages;
+
+	/** Index of each dense Volume in its list of PackageVolumes, used to swap-remove it in constant time. */
+	TArray<int32> VolumePackageIndices;
+
+	/** Registered Volumes grouped by their outermost package, unordered. */
+	TMap<TObjectKey<UPackage>, TArray<FLocalLightingVolumeHandle>> PackageVolumes;
+
+	FDelegateHandle PreSaveHandle;
+	FDelegateHandle SavedHandle;
+#endif
+
+	/** When bound, Volumes are evaluated once per World tick at r.LocalLightingVolume.EvaluationRate instead of per rendered View. */
+	FLocalLightingViewPointProvider ViewPointProvider;
+
+	/** Real time of the last scheduled evaluation. */
+	double LastEvaluationTime;
+
+	/** Blended transitions started by the Volumes, ticked after the scheduled evaluation. */
+	FLocalLightingTransitions Transitions;
+
+	/** Baked Volume state played instead of testing containment, see PlayBakedSequence. */
+	UPROPERTY(Transient)
+	TObjectPtr<ULocalLightingSequenceBake> BakedSequence;
+
+	TWeakObjectPtr<ULevelSequencePlayer> BakedSequencePlayer;
+
+	/** Key of BakedSequence applied last, INDEX_NONE before the first key. */
+	int32 BakedKeyIndex;
+
+	struct FPendingSkyCapture
+	{
+		TWeakObjectPtr<USkyLightComponent> SkyLightComponent;
+		/** Whether every change requesting the capture is picked up by a real time capture on its own. */
+		bool bCoveredByRealTimeCapture = true;
+#if ENABLE_DRAW_DEBUG
+		/** Volumes whose changes requested the capture, each counted once it executes. */
+		TArray<TWeakObjectPtr<const ALocalLightingVolumeBase>, TInlineAllocator<2>> Requesters;
+#endif
+	};
+
+	/** Sky Lights invalidated since the last capture, captured together once the minimum interval elapsed. */
+	TArray<FPendingSkyCapture> PendingSkyCaptures;
+
+	/** Real time of the last executed sky capture. */
+	double LastSkyCaptureTime;
+
+#if ENABLE_DRAW_DEBUG
+	/** View Point of the last evaluation, the candidates drawn by r.LocalLightingVolume.Debug are the Volumes around it. */
+	FVector LastViewPoint;
+#endif
+
+	/** Whether the View overrides are resolved per View this frame, see r.LocalLightingVolume.PerViewOverrides. */
+	bool bPerViewOverrides;
+
+	/** Whether ApplySnapshot is running. */
+	bool bApplyingSnapshot;
+
+	/** Quality levels the scalability variants of the Volumes were last selected for. */
+	Scalability::FQualityLevels QualityLevels;
+
+	FConsoleVariableSinkHandle ScalabilitySinkHandle;
+
+	FDelegateHandle TickStartHandle;
+	FDelegateHandle PostActorTickHandle;
 
 public:
 	ULocalLightingSubsystem();
@@ -33,11 +157,138 @@ public:
 
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
+	virtual void Deinitialize() override;
+
+	//~ Begin UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	//~ End UObject Interface
+
+	/** Memory allocated by the containers of the subsystem, excluding the Volumes themselves. */
+	SIZE_T GetAllocatedSize() const;
+
 	static ULocalLightingSubsystem* Get(UObject* WorldContextObject);
 
 	void ProcessVolume(const FVector& ViewPoint);
 
+	/** Queue the Volume to be registered on the next flush. Thread safe. */
 	void RegisterVolume(IInterface_LocalLightingVolume* Volume);
 
+	/** Queue the Volume to be unregistered on the next flush. Thread safe, the handle of the Volume is released by the flush. */
 	void UnregisterVolume(IInterface_LocalLightingVolume* Volume);
+
+	/** Refresh the bounds the Volume is filtered with, e.g. once it moved. Game thread only. */
+	void UpdateVolumeBounds(IInterface_LocalLightingVolume* Volume);
+
+	/** Apply every queued registration and unregistration. Game thread only. */
+	void FlushPendingVolumes();
+
+	/**
+	 * Whether only the View overrides of the Volumes are resolved per View, leaving every light component untouched.
+	 * Controlled by r.LocalLightingVolume.PerViewOverrides.
+	 */
+	static bool IsPerViewOverridesEnabled();
+
+	/** Whether this World resolves the View overrides per View, switched at the start of the World tick. */
+	bool IsUsingPerViewOverrides() const;
+
+	/**
+	 * Apply the View overrides of every Volume encompassing the View Point to the settings of a View, from the largest Volume
+	 * to the smallest so that the most local one wins. No component is mutated. Game thread only.
+	 */
+	void ResolveViewOverrides(const FVector& ViewPoint, FLocalLightingViewOverrides& InOutOverrides);
+
+	bool IsValidHandle(const FLocalLightingVolumeHandle& Handle) const;
+
+	int32 GetNumVolumes() const;
+
+	/** Whether any Volume is registered or queued to be, FLocalLightingVolumeViewExtension stays inactive for this World otherwise. */
+	bool HasVolumes() const;
+
+	/**
+	 * Evaluate Volumes from the given View Point provider at a fixed rate, decoupled from rendering.
+	 * FLocalLightingVolumeViewExtension only drives the evaluation while no provider is bound.
+	 */
+	void SetViewPointProvider(const FLocalLightingViewPointProvider& Provider);
+
+	void ClearViewPointProvider();
+
+	bool HasViewPointProvider() const;
+
+	FLocalLightingTransitions& GetTransitions();
+
+	/**
+	 * Request a recapture of the Sky Light instead of calling SetCaptureIsDirty directly.
+	 * Every request of a frame is coalesced into one capture, at most once per r.LocalLightingVolume.SkyCapture.MinInterval.
+	 * Requests covered by the real time capture, e.g. the lower hemisphere of a captured scene, are skipped while it is enabled.
+	 * The executed capture is counted in the debug counters of the requesting Volume.
+	 */
+	void RequestSkyCapture(USkyLightComponent* SkyLightComponent, bool bCoveredByRealTimeCapture = false, const ALocalLightingVolumeBase* Requester = nullptr);
+
+	/** Execute the pending sky captures now, regardless of the minimum interval. */
+	void FlushSkyCaptures();
+
+	/**
+	 * Enter and exit Volumes from the keys baked along the camera cuts of a cinematic, following the time of its Player.
+	 * Containment is not tested until the baked Sequence is stopped.
+	 */
+	void PlayBakedSequence(ULocalLightingSequenceBake* Bake, ULevelSequencePlayer* Player);
+
+	void StopBakedSequence();
+
+	bool IsPlayingBakedSequence() const;
+
+	/**
+	 * Capture the Volumes the View Point is in and the baseline of every Actor they override.
+	 * Paths are stored without PIE prefix, so that a snapshot taken in PIE applies to the editor World and the other way around.
+	 */
+	FLocalLightingSnapshot CaptureSnapshot();
+
+	/**
+	 * Land on the lighting of the snapshot in one batched apply, e.g. after loading a save game or across a sublevel transition.
+	 * Active Volumes matching the start of the snapshot are left untouched. The others are left, the overridden Actors put back
+	 * on their baseline and the remaining Volumes of the snapshot entered, without testing containment, without transitions
+	 * and with a single capture per Sky Light. Volumes of the snapshot not registered in this World are skipped.
+	 * Returns false while a baked Sequence drives the Volumes or the View overrides are resolved per View.
+	 */
+	bool ApplySnapshot(const FLocalLightingSnapshot& Snapshot);
+
+	/** Whether ApplySnapshot is running, the Volumes then write their overrides without transition. */
+	bool IsApplyingSnapshot() const;
+
+	/** View Point of the camera of the given local player. */
+	static FLocalLightingViewPointProvider MakePlayerCameraViewPointProvider(UWorld* World, int32 PlayerIndex = 0);
+
+	/** View Point at the location of the Pawn of the given local player. */
+	static FLocalLightingViewPointProvider MakePlayerPawnViewPointProvider(UWorld* World, int32 PlayerIndex = 0);
+
+	/** View Point at the location of a custom Component. */
+	static FLocalLightingViewPointProvider MakeComponentViewPointProvider(USceneComponent* Component);
+
+protected:
+	void AddVolume(IInterface_LocalLightingVolume* Volume);
+
+	void RemoveVolume(const FLocalLightingVolumeHandle& Handle);
+
+	void ResetVolumes();
+
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void EvaluateBakedSequence();
+
+	void UpdateSkyCaptures(double CurrentTime);
+
+#if ENABLE_DRAW_DEBUG
+	/** Draw every Volume colored by its cost, see r.LocalLightingVolume.Debug. */
+	void DrawDebugVolumes();
+#endif
+
+	/** Select the scalability variants of the Volumes again when a scalability group changed. */
+	void OnConsoleVariablesChanged();
+
+#if WITH_EDITOR
+	void OnPackagePreSave(UPackage* Package, FObjectPreSaveContext Context);
+	void OnPackageSaved(const FString& FileName, UPackage* Package, FObjectPostSaveContext Context);
+#endif
 };
@@ -0,0 +1,104 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class ULightComponentBase;
+
+/** Numeric light component properties that can be blended between override states. */
+enum class ELocalLightingBlendProperty : uint8
+{
+	Intensity,
+	LightColor,
+	IndirectLightingIntensity,
+	VolumetricScatteringIntensity,
+	/** World rotation of the component, blended as a quaternion. */
+	Rotation,
+};
+
+/**
+ * Blends light component properties towards their target values over time, owned by ULocalLightingSubsystem.
+ * Updates are capped at r.LocalLightingVolume.Transition.UpdateRate and skipped while the change since the last
+ * update stays under r.LocalLightingVolume.Transition.Threshold, so that a transition only dirties the render state
+ * a handful of times. The last update always writes the exact target value.
+ * Rotations are further limited by the r.LocalLightingVolume.Transition.Rotation* CVars, since every transform update
+ * of a light invalidates its cached shadows.
+ */
+class LOCALLIGHTINGVOLUME_API FLocalLightingTransitions
+{
+public:
+	/**
+	 * Move the property towards Value over Duration seconds, retargeting the running transition if any.
+	 * A Duration of 0 writes Value immediately.
+	 */
+	void SetValue(ULightComponentBase* Component, ELocalLightingBlendProperty Property, const FVector4& Value, float Duration);
+
+	/** Value the property settles to once its running transition ends, or its current value. */
+	FVector4 GetSettledValue(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const;
+
+	/** Advance every running transition by the World delta time, which also paces the update rate. */
+	void Tick(float DeltaSeconds);
+
+	/** Write the target value of every running transition immediately. */
+	void Settle();
+
+	/** Write the target value of the running transitions of the component immediately, before it is written directly. */
+	void Settle(const ULightComponentBase* Component);
+
+	void Reset();
+
+	int32 Num() const;
+
+	SIZE_T GetAllocatedSize() const;
+
+	/** Rotation transitions ended so far, by reaching their target or being settled. Kept across Reset. */
+	int32 GetNumEndedRotationTransitions() const;
+
+	/** Transform updates of the last rotation transition that ended, each invalidating the cached shadows of the light. */
+	int32 GetLastRotationUpdatesPerTransition() const;
+
+	int32 GetMaxRotationUpdatesPerTransition() const;
+
+	float GetAverageRotationUpdatesPerTransition() const;
+
+	static FVector4 ReadValue(const ULightComponentBase* Component, ELocalLightingBlendProperty Property);
+
+	static void WriteValue(ULightComponentBase* Component, ELocalLightingBlendProperty Property, const FVector4& Value);
+
+private:
+	struct FTransition
+	{
+		TWeakObjectPtr<ULightComponentBase> Component;
+		ELocalLightingBlendProperty Property = ELocalLightingBlendProperty::Intensity;
+		FVector4 From = FVector4(0.0f);
+		FVector4 To = FVector4(0.0f);
+		/** Value written by the last update, compared against the threshold. */
+		FVector4 LastValue = FVector4(0.0f);
+		float Duration = 0.0f;
+		float Elapsed = 0.0f;
+		/** Time elapsed since the last update, paced by r.LocalLightingVolume.Transition.UpdateRate. */
+		float TimeSinceUpdate = FLT_MAX;
+		/** Writes to the component so far, each rotation write invalidating the cached shadows of the light. */
+		int32 NumUpdates = 0;
+	};
+
+	TArray<FTransition> Transitions;
+
+	int32 NumEndedRotationTransitions = 0;
+	int64 NumEndedRotationUpdates = 0;
+	int32 LastRotationUpdatesPerTransition = 0;
+	int32 MaxRotationUpdatesPerTransition = 0;
+
+	int32 FindTransition(const ULightComponentBase* Component, ELocalLightingBlendProperty Property) const;
+
+	/** Publish the updates of a transition once it ends, see GetLastRotationUpdatesPerTransition. */
+	void OnTransitionEnded(ELocalLightingBlendProperty Property, int32 NumUpdates);
+};
@@ -8,7 +8,16 @@
 #pragma once
 
 // Engine Include
+#include "HAL/LowLevelMemTracker.h"
+#include "Logging/LogMacros.h"
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
+
+LOCALLIGHTINGVOLUME_API DECLARE_LOG_CATEGORY_EXTERN(LogLocalLightingVolume, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("LocalLightingVolume"), STATGROUP_LocalLightingVolume, STATCAT_Advanced);
+
+LLM_DECLARE_TAG_API(LocalLightingVolume, LOCALLIGHTINGVOLUME_API);
 
 class FLocalLightingVolumeModule : public IModuleInterface
 {
@@ -0,0 +1,53 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "EngineDefines.h"
+
+#if ENABLE_DRAW_DEBUG
+enum class ELocalLightingDebugEvent : uint8
+{
+	/** Containment of the View Point tested. */
+	Test,
+	/** View Point entered or left the Volume. */
+	Transition,
+	/** Value written to a target component or Console Variable, blended or set directly. */
+	Mutation,
+	/** Sky Light recapture executed for a change requested by the Volume. */
+	SkyRecapture,
+	Num,
+};
+
+/**
+ * Events of a Volume counted over the sliding window of r.LocalLightingVolume.Debug.Window, drawn by ULocalLightingSubsystem.
+ * Only counted while r.LocalLightingVolume.Debug is enabled.
+ */
+struct LOCALLIGHTINGVOLUME_API FLocalLightingVolumeDebugCounters
+{
+	static bool IsEnabled();
+
+	void Add(ELocalLightingDebugEvent Event, uint32 Count = 1);
+
+	uint32 GetTotal(ELocalLightingDebugEvent Event);
+
+	/** Weighted sum of the events over the window, a sky recapture costing far more than a containment test. */
+	float GetCost();
+
+private:
+	static constexpr int32 NumBuckets = 8;
+
+	uint32 Counts[static_cast<int32>(ELocalLightingDebugEvent::Num)][NumBuckets] = {};
+
+	/** Absolute index of the bucket being filled, buckets older than the window are cleared when it advances. */
+	int64 CurrentBucket = 0;
+
+	void Advance();
+};
+#endif
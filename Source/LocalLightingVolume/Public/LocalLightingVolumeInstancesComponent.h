@@ -0,0 +1,91 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+
+// Plugins Include
+#include "LocalLightingShape.h"
+
+// Generated Include
+#include "LocalLightingVolumeInstancesComponent.generated.h"
+
+/**
+ * Instances of the analytic Shape of the owning Local Lighting Volume, e.g. the rooms of a procedurally generated interior.
+ * Every instance shares the overrides and the target light of the Volume, which stays a single entry of ULocalLightingSubsystem,
+ * so hundreds of regions cost one Actor and one packed array of transforms instead of one Volume Actor each.
+ * The View Point is in the range of Volume when any instance encompasses it.
+ */
+UCLASS(ClassGroup = Rendering, meta = (BlueprintSpawnableComponent))
+class LOCALLIGHTINGVOLUME_API ULocalLightingVolumeInstancesComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+protected:
+	/** Transforms of the instances, relative to this component. */
+	UPROPERTY(EditAnywhere, Category = "Instances", meta = (MakeEditWidget))
+	TArray<FTransform> InstanceTransforms;
+
+	/** Extent of the Shape of the owning Volume, in instance space. */
+	FVector ShapeExtent;
+
+	/** Instances packed for containment queries, in the order of InstanceTransforms. */
+	FLocalLightingShapeInstances ShapeInstances;
+
+public:
+	ULocalLightingVolumeInstancesComponent();
+
+	/** Add instances in one batch, returns the index of the first one. */
+	UFUNCTION(BlueprintCallable, Category = "Components|Instances")
+	int32 AddInstances(const TArray<FTransform>& Transforms);
+
+	/** Remove instances in one batch, the remaining instances keep their order. */
+	UFUNCTION(BlueprintCallable, Category = "Components|Instances")
+	void RemoveInstances(const TArray<int32>& Indices);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|Instances")
+	void ClearInstances();
+
+	UFUNCTION(BlueprintCallable, Category = "Components|Instances")
+	bool UpdateInstanceTransform(int32 Index, const FTransform& Transform);
+
+	UFUNCTION(BlueprintCallable, Category = "Components|Instances")
+	int32 GetInstanceCount() const;
+
+	const TArray<FTransform>& GetInstanceTransforms() const;
+
+	/** World bounds of all instances. */
+	const FBox& GetInstancesBounds() const;
+
+	/** Called by the owning Volume whenever its Shape changes. */
+	void SetShapeExtent(const FVector& Extent);
+
+	const FLocalLightingShapeInstances& GetShapeInstances() const;
+
+	//~ Begin USceneComponent Interface
+	virtual void OnRegister() override;
+	//~ End USceneComponent Interface
+
+	//~ Begin UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	//~ End UObject Interface
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	virtual void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
+
+	void RebuildInstances();
+
+	/** Let the owning Volume refresh its bounds in ULocalLightingSubsystem, the instances replacing its single Shape. */
+	void UpdateOwnerBounds();
+};
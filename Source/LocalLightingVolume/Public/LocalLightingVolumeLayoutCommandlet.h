@@ -0,0 +1,41 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+// Generated Include
+#include "LocalLightingVolumeLayoutCommandlet.generated.h"
+
+/**
+ * Load a map headlessly and report the layout of its Local Lighting Volumes:
+ * overlap depth, candidates per spatial cell, conflicting and no-op overrides, sky recaptures,
+ * and the containment cost of an evaluation along paths sampled on the navigation mesh.
+ *
+ * Usage: -run=LocalLightingVolumeLayout -Map=/Game/Maps/MyMap [-CellSize=1000] [-PathCount=32] [-SampleSpacing=200] [-EyeHeight=160] [-Seed=0]
+ *        [-MaxOverlapDepth=N] [-MaxCellCandidates=N] [-FailOnConflicts] [-FailOnNoOp] [-Merge [-MergeTolerance=1] [-Save]]
+ * Returns 1 when a limit is exceeded, so that content submissions can be gated on it.
+ *
+ * -Merge then merges the touching Volumes sharing the same overrides and Shape settings into one Volume each,
+ * and reports the Volume count and the containment cost before and after. -Save writes the merged map,
+ * and fails on maps saving their actors in external packages.
+ */
+UCLASS()
+class LOCALLIGHTINGVOLUME_API ULocalLightingVolumeLayoutCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	ULocalLightingVolumeLayoutCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -11,14 +11,55 @@
 #include "CoreMinimal.h"
 #include "SceneViewExtension.h"
 
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+
+class FRDGBuilder;
+class FSceneInterface;
+class ULocalLightingSubsystem;
+
+/**
+ * Evaluates the Volumes of the World of every View, unless the subsystem evaluates them on its own.
+ * With r.LocalLightingVolume.PerViewOverrides, only resolves the View overrides of every View and applies them on the render thread.
+ * Only active for Worlds with registered Volumes, so that menus and preview scenes pay nothing per View.
+ */
 class FLocalLightingVolumeViewExtension : public FSceneViewExtensionBase
 {
 public:
 	FLocalLightingVolumeViewExtension(const FAutoRegister& AutoRegister);
+	virtual ~FLocalLightingVolumeViewExtension();
 
 	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override;
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override;
+	virtual void PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView) override;
+
+protected:
+	virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override;
 
 private:
+	struct FSceneSubsystem
+	{
+		/** World of the Scene when the subsystem was resolved, the entry is stale once it differs. */
+		TWeakObjectPtr<UWorld> World;
+		/** Null for Worlds without subsystem, e.g. editor preview scenes. */
+		TWeakObjectPtr<ULocalLightingSubsystem> Subsystem;
+	};
+
+	/** Subsystem of every Scene seen so far, resolved once instead of per View. */
+	mutable TMap<const FSceneInterface*, FSceneSubsystem> SceneSubsystems;
+
+	FDelegateHandle WorldCleanupHandle;
+
+	/** Whether the last View Family sent View overrides to the render thread, families without any only clear them once. */
+	bool bSentViewOverrides = false;
+
+	/** View overrides of the View Family being rendered, by View index. Render thread only. */
+	TArray<FLocalLightingViewOverrides, TInlineAllocator<4>> ViewOverrides_RenderThread;
+
+	ULocalLightingSubsystem* FindSubsystem(const FSceneInterface* Scene) const;
+
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
 	inline static TSharedPtr<FLocalLightingVolumeViewExtension, ESPMode::ThreadSafe> Instance;
 
 	struct FStaticConstructor
@@ -0,0 +1,93 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+
+// Generated Include
+#include "LocalSkyAtmosphereVolume.generated.h"
+
+/**
+ * Allow to modify Sky Atmosphere when View Point in the range of Volume.
+ */
+UCLASS(AutoExpandCategories = ("Sky Atmosphere"), MinimalAPI)
+class ALocalSkyAtmosphereVolume : public ALocalLightingVolumeBase
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bVisible:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bFastSkyLUT:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_FastSkyLUTSampleCountMax:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_SampleCountMax:1;
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Atmosphere")
+	TWeakObjectPtr<class ASkyAtmosphere> SkyAtmosphere;
+
+	/**
+	 * Whether the sky atmosphere is rendered at all.
+	 * Sealed interiors never see the sky, hiding it there skips its LUTs and its sky pass.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Atmosphere", meta = (DisplayName = "Visible", EditCondition = "bOverride_bVisible"))
+	bool bVisible;
+
+	/**
+	 * Whether the sky is rendered from the sky view LUT rather than ray marched per pixel (r.SkyAtmosphere.FastSkyLUT).
+	 * The LUT quality is a renderer setting, it is shared by every Sky Atmosphere of the World.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Atmosphere", meta = (DisplayName = "Fast Sky LUT", EditCondition = "bOverride_bFastSkyLUT"))
+	bool bFastSkyLUT;
+
+	/** Maximum sample count used to compute the sky view LUT (r.SkyAtmosphere.FastSkyLUT.SampleCountMax). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Atmosphere", meta = (UIMin = "1", UIMax = "64", ClampMin = "1", EditCondition = "bOverride_FastSkyLUTSampleCountMax"))
+	float FastSkyLUTSampleCountMax;
+
+	/** Maximum sample count used when ray marching the atmosphere per pixel (r.SkyAtmosphere.SampleCountMax). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Atmosphere", meta = (UIMin = "1", UIMax = "64", ClampMin = "1", EditCondition = "bOverride_SampleCountMax"))
+	float SampleCountMax;
+
+	UPROPERTY(Transient)
+	bool bCacheVisible;
+
+public:
+	ALocalSkyAtmosphereVolume();
+
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual AActor* GetOverrideTarget() const override;
+	//~ End ALocalLightingVolumeBase Interface
+
+	//~ Begin AActor Interface
+	virtual void PostUnregisterAllComponents() override;
+	//~ End AActor Interface
+
+protected:
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual void OverrideLighting() override;
+	virtual void RestoreLighting() override;
+	//~ End ALocalLightingVolumeBase Interface
+
+public:
+    //~ Begin UObject Interface
+#if WITH_EDITOR
+	virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual bool CanEditChange(const FProperty* InProperty) const override;
+#endif // WITH_EDITOR
+    //~ End UObject Interface
+};
@@ -45,6 +45,12 @@ protected:
 	uint8 bOverride_bLowerHemisphereIsBlack:1;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
 	uint8 bOverride_LowerHemisphereColor:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bAffectsWorld:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_CubemapResolution:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bRealTimeCaptureTimeSliced:1;
 
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -99,16 +105,46 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Light", meta = (EditCondition = "bOverride_LowerHemisphereColor"))
 	FLinearColor LowerHemisphereColor;
 
+	/**
+	 * Whether the Sky Light contributes to the world at all.
+	 * Disabling it skips the capture and the sky lighting entirely, e.g. for sealed interiors.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Light|Capture", meta = (DisplayName = "Affects World", EditCondition = "bOverride_bAffectsWorld"))
+	bool bAffectsWorld;
+
+	/** Maximum resolution for the very top processed cubemap mip. Must be a power of 2. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Light|Capture", meta = (UIMin = "8", UIMax = "1024", EditCondition = "bOverride_CubemapResolution"))
+	int32 CubemapResolution;
+
+	/**
+	 * Whether the real time capture is spread over several frames (r.SkyLight.RealTimeReflectionCapture.TimeSlice).
+	 * Time slicing lowers the per frame cost of the real time capture at the price of a slower update rate.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sky Light|Capture", meta = (DisplayName = "Real Time Capture Time Sliced", EditCondition = "bOverride_bRealTimeCaptureTimeSliced"))
+	bool bRealTimeCaptureTimeSliced;
+
+	UPROPERTY(Transient)
 	bool bCacheRealTimeCapture;
+	UPROPERTY(Transient)
 	TEnumAsByte<ESkyLightSourceType> CacheSourceType;
 	UPROPERTY(Transient)
 	TObjectPtr<UTextureCube> CacheCubemap;
+	UPROPERTY(Transient)
 	float CacheIntensity;
+	UPROPERTY(Transient)
 	FColor CacheLightColor;
+	UPROPERTY(Transient)
 	float CacheIndirectLightingIntensity;
+	UPROPERTY(Transient)
 	float CacheVolumetricScatteringIntensity;
+	UPROPERTY(Transient)
 	bool bCacheLowerHemisphereIsBlack;
+	UPROPERTY(Transient)
 	FLinearColor CacheLowerHemisphereColor;
+	UPROPERTY(Transient)
+	bool bCacheAffectsWorld;
+	UPROPERTY(Transient)
+	int32 CacheCubemapResolution;
 
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Transient)
@@ -122,15 +158,25 @@ protected:
 	uint8 bCacheOverride_VolumetricScatteringIntensity:1;
 	uint8 bCacheOverride_bLowerHemisphereIsBlack:1;
 	uint8 bCacheOverride_LowerHemisphereColor:1;
+	uint8 bCacheOverride_bAffectsWorld:1;
+	uint8 bCacheOverride_CubemapResolution:1;
+	uint8 bCacheOverride_bRealTimeCaptureTimeSliced:1;
 #endif
 
 public:
 	ALocalSkyLightVolume();
 
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual void GetReferencedTextures(TArray<UTexture*>& OutTextures) const override;
+	virtual AActor* GetOverrideTarget() const override;
+	virtual bool TriggersSkyRecapture() const override;
+	//~ End ALocalLightingVolumeBase Interface
+
 protected:
 	//~ Begin ALocalLightingVolumeBase Interface
 	virtual void OverrideLighting() override;
 	virtual void RestoreLighting() override;
+	virtual void UpdateBlendWeight() override;
 	//~ End ALocalLightingVolumeBase Interface
 
 public:
@@ -0,0 +1,92 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+
+// Plugins Include
+#include "Interface_LocalLightingVolume.h"
+
+// Generated Include
+#include "LocalVolumetricCloudVolume.generated.h"
+
+/**
+ * Allow to modify Volumetric Cloud when View Point in the range of Volume.
+ */
+UCLASS(AutoExpandCategories = ("Volumetric Cloud"), MinimalAPI)
+class ALocalVolumetricCloudVolume : public ALocalLightingVolumeBase
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bVisible:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ViewSampleCountScale:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ShadowViewSampleCountScale:1;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_TracingMaxDistance:1;
+
+	//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volumetric Cloud")
+	TWeakObjectPtr<class AVolumetricCloud> VolumetricCloud;
+
+	/**
+	 * Whether the clouds are rendered at all.
+	 * The cloud ray marching is often the most expensive part of the sky, hiding it underground saves all of it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volumetric Cloud", meta = (DisplayName = "Visible", EditCondition = "bOverride_bVisible"))
+	bool bVisible;
+
+	/** Scale the tracing sample count in primary views. Quality level scalability CVARs affect the maximum range. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volumetric Cloud", meta = (UIMin = "0.05", UIMax = "8", ClampMin = "0.05", SliderExponent = 1.0, EditCondition = "bOverride_ViewSampleCountScale"))
+	float ViewSampleCountScale;
+
+	/** Scale the shadow tracing sample count in primary views, only used with Advanced Output ray marched shadows. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volumetric Cloud", meta = (UIMin = "0.05", UIMax = "8", ClampMin = "0.05", SliderExponent = 1.0, EditCondition = "bOverride_ShadowViewSampleCountScale"))
+	float ShadowViewSampleCountScale;
+
+	/** The maximum distance that will be traced inside the cloud layer. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Volumetric Cloud", meta = (UIMin = 1.0f, UIMax = 500.0f, ClampMin = 0.1f, SliderExponent = 2.0, Units = "km", EditCondition = "bOverride_TracingMaxDistance"))
+	float TracingMaxDistance;
+
+	UPROPERTY(Transient)
+	bool bCacheVisible;
+	UPROPERTY(Transient)
+	float CacheViewSampleCountScale;
+	UPROPERTY(Transient)
+	float CacheShadowViewSampleCountScale;
+	UPROPERTY(Transient)
+	float CacheTracingMaxDistance;
+
+public:
+	ALocalVolumetricCloudVolume();
+
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual AActor* GetOverrideTarget() const override;
+	//~ End ALocalLightingVolumeBase Interface
+
+protected:
+	//~ Begin ALocalLightingVolumeBase Interface
+	virtual void OverrideLighting() override;
+	virtual void RestoreLighting() override;
+	//~ End ALocalLightingVolumeBase Interface
+
+public:
+    //~ Begin UObject Interface
+#if WITH_EDITOR
+	virtual void PreEditChange(FProperty* PropertyAboutToChange) override;
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual bool CanEditChange(const FProperty* InProperty) const override;
+#endif // WITH_EDITOR
+    //~ End UObject Interface
+};
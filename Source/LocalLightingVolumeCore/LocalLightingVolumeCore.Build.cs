@@ -0,0 +1,19 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class LocalLightingVolumeCore : ModuleRules
+{
+	public LocalLightingVolumeCore(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		// Evaluation core of the Local Lighting Volumes, free of any UObject so that it can be linked by standalone programs.
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+			);
+	}
+}
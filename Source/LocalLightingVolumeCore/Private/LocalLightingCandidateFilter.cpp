@@ -0,0 +1,61 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingCandidateFilter.h"
+
+int32 FLocalLightingCandidateFilter::Add(const FBox& InBounds)
+{
+	return Bounds.Add(InBounds);
+}
+
+void FLocalLightingCandidateFilter::SetBounds(int32 Index, const FBox& InBounds)
+{
+	Bounds[Index] = InBounds;
+}
+
+void FLocalLightingCandidateFilter::RemoveAtSwap(int32 Index)
+{
+	Bounds.RemoveAtSwap(Index);
+}
+
+void FLocalLightingCandidateFilter::Reset()
+{
+	Bounds.Reset();
+}
+
+int32 FLocalLightingCandidateFilter::Num() const
+{
+	return Bounds.Num();
+}
+
+const FBox& FLocalLightingCandidateFilter::GetBounds(int32 Index) const
+{
+	return Bounds[Index];
+}
+
+bool FLocalLightingCandidateFilter::IsCandidate(int32 Index, const FVector& Point) const
+{
+	// FBox::IsInsideOrOn ignores IsValid, an empty Brush would otherwise contain the origin.
+	return Bounds[Index].IsValid && Bounds[Index].IsInsideOrOn(Point);
+}
+
+void FLocalLightingCandidateFilter::GatherCandidates(const FVector& Point, TArray<int32, TInlineAllocator<64>>& OutCandidates) const
+{
+	for (int32 Index = 0; Index < Bounds.Num(); Index++)
+	{
+		if (IsCandidate(Index, Point))
+		{
+			OutCandidates.Add(Index);
+		}
+	}
+}
+
+SIZE_T FLocalLightingCandidateFilter::GetAllocatedSize() const
+{
+	return Bounds.GetAllocatedSize();
+}
@@ -0,0 +1,39 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingOverrideDiff.h"
+
+bool FLocalLightingOverrideDiff::IsEmpty() const
+{
+	return Added.Num() == 0 && Removed.Num() == 0 && Changed.Num() == 0;
+}
+
+FLocalLightingOverrideDiff FLocalLightingOverrideDiff::Compute(const FLocalLightingOverridePayload& From, const FLocalLightingOverridePayload& To)
+{
+	FLocalLightingOverrideDiff Diff;
+	for (const TPair<FName, FString>& Pair : From)
+	{
+		const FString* ToValue = To.Find(Pair.Key);
+		if (!ToValue)
+		{
+			Diff.Removed.Add(Pair.Key);
+		}
+		else if (*ToValue != Pair.Value)
+		{
+			Diff.Changed.Add(Pair.Key);
+		}
+	}
+	for (const TPair<FName, FString>& Pair : To)
+	{
+		if (!From.Contains(Pair.Key))
+		{
+			Diff.Added.Add(Pair.Key);
+		}
+	}
+	return Diff;
+}
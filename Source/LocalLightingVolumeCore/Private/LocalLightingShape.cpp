@@ -0,0 +1,136 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingShape.h"
+
+float FLocalLightingShape::GetLocalDepth(const FVector& LocalPoint) const
+{
+	switch (Type)
+	{
+	case ELocalLightingShapeType::Box:
+		return FMath::Min3(BoxExtent.X - FMath::Abs(LocalPoint.X), BoxExtent.Y - FMath::Abs(LocalPoint.Y), BoxExtent.Z - FMath::Abs(LocalPoint.Z));
+	case ELocalLightingShapeType::Sphere:
+		return SphereRadius - LocalPoint.Size();
+	case ELocalLightingShapeType::Capsule:
+		{
+			const float SegmentHalfLength = FMath::Max(CapsuleHalfHeight - CapsuleRadius, 0.0f);
+			const FVector ClosestPointOnSegment(0.0f, 0.0f, FMath::Clamp<float>(LocalPoint.Z, -SegmentHalfLength, SegmentHalfLength));
+			return CapsuleRadius - FVector::Dist(LocalPoint, ClosestPointOnSegment);
+		}
+	default:
+		return -1.0f;
+	}
+}
+
+FVector FLocalLightingShape::GetLocalExtent() const
+{
+	switch (Type)
+	{
+	case ELocalLightingShapeType::Box:
+		return BoxExtent;
+	case ELocalLightingShapeType::Sphere:
+		return FVector(SphereRadius);
+	case ELocalLightingShapeType::Capsule:
+		return FVector(CapsuleRadius, CapsuleRadius, FMath::Max(CapsuleHalfHeight, CapsuleRadius));
+	default:
+		return FVector::ZeroVector;
+	}
+}
+
+float FLocalLightingShape::GetBlendWeight(float Depth, float BlendDistance)
+{
+	return BlendDistance > 0.0f ? FMath::Clamp(Depth / BlendDistance, 0.0f, 1.0f) : 1.0f;
+}
+
+void FLocalLightingShapeInstances::Rebuild(TArrayView<const FTransform> InstanceToWorlds, const FVector& ShapeExtent)
+{
+	Reset();
+	Add(InstanceToWorlds, ShapeExtent);
+}
+
+int32 FLocalLightingShapeInstances::Add(TArrayView<const FTransform> InstanceToWorlds, const FVector& ShapeExtent)
+{
+	const int32 FirstIndex = WorldInverses.Num();
+	WorldInverses.Reserve(FirstIndex + InstanceToWorlds.Num());
+	InstanceBounds.Reserve(FirstIndex + InstanceToWorlds.Num());
+	for (const FTransform& InstanceToWorld : InstanceToWorlds)
+	{
+		WorldInverses.Add(InstanceToWorld.Inverse());
+		Bounds += InstanceBounds.Add_GetRef(FBox(-ShapeExtent, ShapeExtent).TransformBy(InstanceToWorld));
+	}
+	return FirstIndex;
+}
+
+void FLocalLightingShapeInstances::Reset()
+{
+	WorldInverses.Reset();
+	InstanceBounds.Reset();
+	Bounds.Init();
+}
+
+int32 FLocalLightingShapeInstances::Num() const
+{
+	return WorldInverses.Num();
+}
+
+const FBox& FLocalLightingShapeInstances::GetBounds() const
+{
+	return Bounds;
+}
+
+TConstArrayView<FBox> FLocalLightingShapeInstances::GetInstanceBounds() const
+{
+	return InstanceBounds;
+}
+
+void FLocalLightingShapeInstances::GetCandidateLocalPoints(const FVector& Point, TArray<FVector, TInlineAllocator<8>>& OutLocalPoints) const
+{
+	if (!Bounds.IsInsideOrOn(Point))
+	{
+		return;
+	}
+	for (int32 Index = 0; Index < InstanceBounds.Num(); Index++)
+	{
+		if (InstanceBounds[Index].IsInsideOrOn(Point))
+		{
+			OutLocalPoints.Add(WorldInverses[Index].TransformPosition(Point));
+		}
+	}
+}
+
+bool FLocalLightingShapeInstances::Encompasses(const FLocalLightingShape& Shape, const FVector& Point) const
+{
+	TArray<FVector, TInlineAllocator<8>> LocalPoints;
+	GetCandidateLocalPoints(Point, LocalPoints);
+	for (const FVector& LocalPoint : LocalPoints)
+	{
+		if (Shape.GetLocalDepth(LocalPoint) >= 0.0f)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+float FLocalLightingShapeInstances::GetMaxDepth(const FLocalLightingShape& Shape, const FVector& Point) const
+{
+	// Overlapping instances form one region, the deepest one counts.
+	float Depth = 0.0f;
+	TArray<FVector, TInlineAllocator<8>> LocalPoints;
+	GetCandidateLocalPoints(Point, LocalPoints);
+	for (const FVector& LocalPoint : LocalPoints)
+	{
+		Depth = FMath::Max(Depth, Shape.GetLocalDepth(LocalPoint));
+	}
+	return Depth;
+}
+
+SIZE_T FLocalLightingShapeInstances::GetAllocatedSize() const
+{
+	return WorldInverses.GetAllocatedSize() + InstanceBounds.GetAllocatedSize();
+}
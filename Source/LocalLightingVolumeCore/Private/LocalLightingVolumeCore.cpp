@@ -0,0 +1,21 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Header Include
+#include "LocalLightingVolumeCore.h"
+
+void FLocalLightingVolumeCoreModule::StartupModule()
+{
+
+}
+
+void FLocalLightingVolumeCoreModule::ShutdownModule()
+{
+
+}
+
+IMPLEMENT_MODULE(FLocalLightingVolumeCoreModule, LocalLightingVolumeCore)
@@ -0,0 +1,46 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+
+/**
+ * World bounds of the registered Volumes, packed by dense index so that an evaluation only streams through the bounds,
+ * and only the Volumes whose bounds contain the View Point test their exact Shape.
+ * Indices mirror the dense Volumes of ULocalLightingSubsystem, including their swap-remove.
+ */
+class LOCALLIGHTINGVOLUMECORE_API FLocalLightingCandidateFilter
+{
+public:
+	/** Append the bounds of a new Volume, returns its index. */
+	int32 Add(const FBox& Bounds);
+
+	/** Replace the bounds of the Volume at Index, e.g. once it moved. */
+	void SetBounds(int32 Index, const FBox& Bounds);
+
+	/** Move the last bounds into Index, as the dense Volumes do. */
+	void RemoveAtSwap(int32 Index);
+
+	void Reset();
+
+	int32 Num() const;
+
+	const FBox& GetBounds(int32 Index) const;
+
+	/** Whether the bounds of the Volume at Index contain the point. Invalid bounds contain nothing. */
+	bool IsCandidate(int32 Index, const FVector& Point) const;
+
+	/** Append the index of every Volume whose bounds contain the point, in increasing order. */
+	void GatherCandidates(const FVector& Point, TArray<int32, TInlineAllocator<64>>& OutCandidates) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	TArray<FBox> Bounds;
+};
@@ -0,0 +1,29 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+
+/** Overrides by property name, as exported text, see ALocalLightingVolumeBase::GetOverridePayload. */
+using FLocalLightingOverridePayload = TMap<FName, FString>;
+
+/** Difference between two override payloads. */
+struct LOCALLIGHTINGVOLUMECORE_API FLocalLightingOverrideDiff
+{
+	/** Names only overridden by the second payload. */
+	TArray<FName> Added;
+	/** Names only overridden by the first payload. */
+	TArray<FName> Removed;
+	/** Names overridden by both payloads with different values. */
+	TArray<FName> Changed;
+
+	bool IsEmpty() const;
+
+	static FLocalLightingOverrideDiff Compute(const FLocalLightingOverridePayload& From, const FLocalLightingOverridePayload& To);
+};
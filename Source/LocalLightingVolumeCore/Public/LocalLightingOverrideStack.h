@@ -0,0 +1,101 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+
+/** What the owner of a stack must apply after an override was removed. */
+enum class ELocalLightingOverrideStackChange : uint8
+{
+	/** A lower override was removed, the visible value is unchanged. */
+	None,
+	/** The top override was removed, the new top value is visible. */
+	Top,
+	/** The last override was removed, the baseline value must be restored. */
+	Baseline,
+};
+
+/**
+ * Overrides of one value by several owners: the most recently pushed override wins,
+ * and the baseline is restored once the last one is removed, no matter in which order the owners leave.
+ * Owners are compared with operator==, the stack holds no reference to them.
+ */
+template<typename OwnerType, typename ValueType>
+class TLocalLightingOverrideStack
+{
+public:
+	/** Push the override of Owner on top, replacing its previous override. Returns the value to apply. */
+	const ValueType& Push(const OwnerType& Owner, const ValueType& Value)
+	{
+		Overrides.RemoveAll([&Owner](const FOverride& Override)
+		{
+			return Override.Owner == Owner;
+		});
+		return Overrides.Add_GetRef({ Owner, Value }).Value;
+	}
+
+	ELocalLightingOverrideStackChange Remove(const OwnerType& Owner)
+	{
+		const int32 Index = Overrides.IndexOfByPredicate([&Owner](const FOverride& Override)
+		{
+			return Override.Owner == Owner;
+		});
+		if (Index == INDEX_NONE)
+		{
+			return ELocalLightingOverrideStackChange::None;
+		}
+
+		const bool bWasTop = Index == Overrides.Num() - 1;
+		Overrides.RemoveAt(Index);
+		if (Overrides.Num() == 0)
+		{
+			return ELocalLightingOverrideStackChange::Baseline;
+		}
+		return bWasTop ? ELocalLightingOverrideStackChange::Top : ELocalLightingOverrideStackChange::None;
+	}
+
+	/** Visible value, only valid while the stack is not empty. */
+	const ValueType& Top() const
+	{
+		return Overrides.Last().Value;
+	}
+
+	bool IsEmpty() const
+	{
+		return Overrides.Num() == 0;
+	}
+
+	int32 Num() const
+	{
+		return Overrides.Num();
+	}
+
+	template<typename FunctorType>
+	void ForEachValue(FunctorType&& Functor) const
+	{
+		for (const FOverride& Override : Overrides)
+		{
+			Functor(Override.Value);
+		}
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return Overrides.GetAllocatedSize();
+	}
+
+private:
+	struct FOverride
+	{
+		OwnerType Owner;
+		ValueType Value;
+	};
+
+	TArray<FOverride> Overrides;
+};
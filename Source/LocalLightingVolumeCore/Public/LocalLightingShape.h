@@ -0,0 +1,84 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "CoreMinimal.h"
+
+/** Analytic shapes, mirroring the non Brush values of ELocalLightingVolumeShape. */
+enum class ELocalLightingShapeType : uint8
+{
+	Box,
+	Sphere,
+	Capsule,
+};
+
+/** Analytic Shape of a Volume in Volume space, tested without any physics state. */
+struct LOCALLIGHTINGVOLUMECORE_API FLocalLightingShape
+{
+	ELocalLightingShapeType Type = ELocalLightingShapeType::Box;
+	/** Half extent of the Box. */
+	FVector BoxExtent = FVector(100.0f);
+	float SphereRadius = 100.0f;
+	float CapsuleRadius = 50.0f;
+	/** Half height of the Capsule, including the hemispherical caps. */
+	float CapsuleHalfHeight = 100.0f;
+
+	/** Distance from the local point to the boundary, negative outside. */
+	float GetLocalDepth(const FVector& LocalPoint) const;
+
+	/** Extent of the bounding box, in Volume space. */
+	FVector GetLocalExtent() const;
+
+	/** Weight ramping from 0 on the boundary to 1 at BlendDistance inside. */
+	static float GetBlendWeight(float Depth, float BlendDistance);
+};
+
+/**
+ * Instances of one analytic Shape packed for containment queries.
+ * Transforms, inverses and bounds live in separate arrays, so that candidate filtering only streams through the bounds.
+ */
+class LOCALLIGHTINGVOLUMECORE_API FLocalLightingShapeInstances
+{
+public:
+	/** Rebuild every instance from their instance to world transforms. */
+	void Rebuild(TArrayView<const FTransform> InstanceToWorlds, const FVector& ShapeExtent);
+
+	/** Append instances, returns the index of the first one. */
+	int32 Add(TArrayView<const FTransform> InstanceToWorlds, const FVector& ShapeExtent);
+
+	void Reset();
+
+	int32 Num() const;
+
+	/** World bounds of all instances. */
+	const FBox& GetBounds() const;
+
+	/** World bounds of every instance. */
+	TConstArrayView<FBox> GetInstanceBounds() const;
+
+	/** Point in the space of every instance whose bounds contain it. */
+	void GetCandidateLocalPoints(const FVector& Point, TArray<FVector, TInlineAllocator<8>>& OutLocalPoints) const;
+
+	/** Whether any instance of the Shape contains the point. */
+	bool Encompasses(const FLocalLightingShape& Shape, const FVector& Point) const;
+
+	/** Deepest distance of the point inside any instance of the Shape, 0 outside of them all. */
+	float GetMaxDepth(const FLocalLightingShape& Shape, const FVector& Point) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** World to instance transforms. */
+	TArray<FTransform> WorldInverses;
+
+	/** World bounds of every instance, tested before the exact Shape. */
+	TArray<FBox> InstanceBounds;
+
+	FBox Bounds = FBox(ForceInit);
+};
@@ -0,0 +1,22 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+#pragma once
+
+// Engine Include
+#include "Modules/ModuleManager.h"
+
+/**
+ * Evaluation core of the Local Lighting Volumes: shape containment, candidate filtering, override stacking and override diffs.
+ * Only depends on Core, the Volumes and ULocalLightingSubsystem of LocalLightingVolume are adapters over it.
+ */
+class FLocalLightingVolumeCoreModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
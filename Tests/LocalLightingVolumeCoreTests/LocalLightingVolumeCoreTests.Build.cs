@@ -0,0 +1,20 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class LocalLightingVolumeCoreTests : TestModuleRules
+{
+	public LocalLightingVolumeCoreTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		// Unit tests and throughput benchmarks of the evaluation core, linking nothing but Core and LocalLightingVolumeCore.
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"LocalLightingVolumeCore",
+			}
+			);
+	}
+}
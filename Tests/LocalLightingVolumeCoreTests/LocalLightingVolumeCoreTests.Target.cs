@@ -0,0 +1,17 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class LocalLightingVolumeCoreTestsTarget : TestTargetRules
+{
+	public LocalLightingVolumeCoreTestsTarget(TargetInfo Target) : base(Target)
+	{
+		// Standalone program, e.g. on Linux, without Engine or UObject. The benchmarks are hidden, run them with the [Benchmark] tag.
+		bCompileAgainstEngine = false;
+		bCompileAgainstCoreUObject = false;
+		bCompileAgainstApplicationCore = false;
+		bUsesSlate = false;
+
+		EnablePlugins.Add("LocalLightingVolume");
+	}
+}
@@ -0,0 +1,161 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "TestHarness.h"
+
+// Plugins Include
+#include "LocalLightingCandidateFilter.h"
+#include "LocalLightingOverrideDiff.h"
+#include "LocalLightingOverrideStack.h"
+#include "LocalLightingShape.h"
+
+/** Run Body NumIterations times and print its throughput, the benchmarks are hidden from the default run. */
+template<typename FunctorType>
+static void RunBenchmark(const TCHAR* Name, int32 NumIterations, FunctorType&& Body)
+{
+	// Warm the caches and the branch predictors up before timing.
+	for (int32 Iteration = 0; Iteration < FMath::Max(NumIterations / 10, 1); Iteration++)
+	{
+		Body(Iteration);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+	{
+		Body(Iteration);
+	}
+	const double ElapsedSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+	FPlatformMisc::LocalPrint(*FString::Printf(TEXT("%s: %d iterations in %.3f ms, %.1f ns per iteration, %.2f M per second\n"),
+		Name, NumIterations, ElapsedSeconds * 1000.0, ElapsedSeconds * 1.0e9 / NumIterations, NumIterations / ElapsedSeconds / 1.0e6));
+}
+
+/** View Points spread over the World, generated once so that the random stream is not timed. */
+static TArray<FVector> MakeViewPoints(int32 NumViewPoints, float WorldExtent)
+{
+	FRandomStream RandomStream(0x1F2E3D4C);
+	TArray<FVector> ViewPoints;
+	ViewPoints.Reserve(NumViewPoints);
+	for (int32 Index = 0; Index < NumViewPoints; Index++)
+	{
+		ViewPoints.Add(FVector(RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(-WorldExtent, WorldExtent)));
+	}
+	return ViewPoints;
+}
+
+TEST_CASE("LocalLightingVolume::Core::Benchmark::Containment", "[LocalLightingVolume][Core][Benchmark][.]")
+{
+	const TArray<FVector> ViewPoints = MakeViewPoints(4096, 400.0f);
+	const int32 NumIterations = 1 << 22;
+
+	const ELocalLightingShapeType ShapeTypes[] = { ELocalLightingShapeType::Box, ELocalLightingShapeType::Sphere, ELocalLightingShapeType::Capsule };
+	const TCHAR* ShapeNames[] = { TEXT("Box GetLocalDepth"), TEXT("Sphere GetLocalDepth"), TEXT("Capsule GetLocalDepth") };
+	for (int32 TypeIndex = 0; TypeIndex < UE_ARRAY_COUNT(ShapeTypes); TypeIndex++)
+	{
+		FLocalLightingShape Shape;
+		Shape.Type = ShapeTypes[TypeIndex];
+
+		int32 NumInside = 0;
+		RunBenchmark(ShapeNames[TypeIndex], NumIterations, [&](int32 Iteration)
+		{
+			NumInside += Shape.GetLocalDepth(ViewPoints[Iteration & (ViewPoints.Num() - 1)]) >= 0.0f ? 1 : 0;
+		});
+		CHECK(NumInside > 0);
+	}
+}
+
+TEST_CASE("LocalLightingVolume::Core::Benchmark::ShapeInstances", "[LocalLightingVolume][Core][Benchmark][.]")
+{
+	// Rooms of a procedurally generated interior, on a grid of 16 x 16 x 4.
+	TArray<FTransform> InstanceToWorlds;
+	for (int32 X = 0; X < 16; X++)
+	{
+		for (int32 Y = 0; Y < 16; Y++)
+		{
+			for (int32 Z = 0; Z < 4; Z++)
+			{
+				InstanceToWorlds.Add(FTransform(FRotator(0.0f, 15.0f * X, 0.0f), FVector(X - 8, Y - 8, Z - 2) * 500.0f));
+			}
+		}
+	}
+
+	FLocalLightingShape Shape;
+	Shape.Type = ELocalLightingShapeType::Box;
+	Shape.BoxExtent = FVector(200.0f);
+	FLocalLightingShapeInstances Instances;
+	Instances.Rebuild(InstanceToWorlds, Shape.GetLocalExtent());
+
+	const TArray<FVector> ViewPoints = MakeViewPoints(4096, 4000.0f);
+	int32 NumInside = 0;
+	RunBenchmark(TEXT("1024 Box instances Encompasses"), 1 << 16, [&](int32 Iteration)
+	{
+		NumInside += Instances.Encompasses(Shape, ViewPoints[Iteration & (ViewPoints.Num() - 1)]) ? 1 : 0;
+	});
+	CHECK(NumInside > 0);
+}
+
+TEST_CASE("LocalLightingVolume::Core::Benchmark::CandidateFilter", "[LocalLightingVolume][Core][Benchmark][.]")
+{
+	// Volumes of an open World, a few thousand of them a few hundred meters wide.
+	FRandomStream RandomStream(0x5A6B7C8D);
+	FLocalLightingCandidateFilter Filter;
+	for (int32 Index = 0; Index < 4096; Index++)
+	{
+		const FVector Center(RandomStream.FRandRange(-200000.0f, 200000.0f), RandomStream.FRandRange(-200000.0f, 200000.0f), RandomStream.FRandRange(-5000.0f, 5000.0f));
+		Filter.Add(FBox::BuildAABB(Center, FVector(RandomStream.FRandRange(2000.0f, 20000.0f))));
+	}
+
+	const TArray<FVector> ViewPoints = MakeViewPoints(4096, 200000.0f);
+	int32 NumCandidates = 0;
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	RunBenchmark(TEXT("4096 Volumes GatherCandidates"), 1 << 14, [&](int32 Iteration)
+	{
+		Candidates.Reset();
+		Filter.GatherCandidates(ViewPoints[Iteration & (ViewPoints.Num() - 1)], Candidates);
+		NumCandidates += Candidates.Num();
+	});
+	CHECK(NumCandidates >= 0);
+}
+
+TEST_CASE("LocalLightingVolume::Core::Benchmark::OverrideStack", "[LocalLightingVolume][Core][Benchmark][.]")
+{
+	// Nested Volumes entering and leaving in arbitrary order, a handful deep.
+	TLocalLightingOverrideStack<int32, FString> Stack;
+	const FString Value(TEXT("1.000000"));
+	int32 NumBaselines = 0;
+	RunBenchmark(TEXT("Override stack Push and Remove, 8 deep"), 1 << 20, [&](int32 Iteration)
+	{
+		Stack.Push(Iteration & 7, Value);
+		if (Stack.Remove((Iteration * 5 + 3) & 7) == ELocalLightingOverrideStackChange::Baseline)
+		{
+			NumBaselines++;
+		}
+	});
+	CHECK(NumBaselines >= 0);
+}
+
+TEST_CASE("LocalLightingVolume::Core::Benchmark::OverrideDiff", "[LocalLightingVolume][Core][Benchmark][.]")
+{
+	// Payloads of a Directional Light Volume with every override enabled.
+	FLocalLightingOverridePayload From;
+	for (int32 Index = 0; Index < 12; Index++)
+	{
+		From.Add(FName(TEXT("Override"), Index), FString::Printf(TEXT("%d.000000"), Index));
+	}
+	FLocalLightingOverridePayload To = From;
+	To[FName(TEXT("Override"), 3)] = TEXT("0.500000");
+	To.Remove(FName(TEXT("Override"), 7));
+
+	int32 NumChanged = 0;
+	RunBenchmark(TEXT("Override diff of 12 overrides"), 1 << 18, [&](int32 Iteration)
+	{
+		NumChanged += FLocalLightingOverrideDiff::Compute(From, To).Changed.Num();
+	});
+	CHECK(NumChanged > 0);
+}
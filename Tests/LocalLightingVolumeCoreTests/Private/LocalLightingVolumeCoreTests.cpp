@@ -0,0 +1,198 @@
+// Copyright Technical Artist - Jiahao.Chan, Individual. All Rights Reserved.
+
+/**
+ * Plugin LocalLightingVolume:
+ *		Allow to modify global Light Component such as Sky Light & Directional Light when View Point in the range of Volume.
+ */
+
+// Engine Include
+#include "CoreMinimal.h"
+#include "TestHarness.h"
+
+// Plugins Include
+#include "LocalLightingCandidateFilter.h"
+#include "LocalLightingOverrideDiff.h"
+#include "LocalLightingOverrideStack.h"
+#include "LocalLightingShape.h"
+
+TEST_CASE("LocalLightingVolume::Core::Shape::Containment", "[LocalLightingVolume][Core]")
+{
+	FLocalLightingShape Shape;
+
+	SECTION("Box")
+	{
+		Shape.Type = ELocalLightingShapeType::Box;
+		Shape.BoxExtent = FVector(100.0f, 200.0f, 300.0f);
+		CHECK(Shape.GetLocalDepth(FVector::ZeroVector) == 100.0f);
+		CHECK(Shape.GetLocalDepth(FVector(0.0f, 150.0f, 0.0f)) == 50.0f);
+		CHECK(Shape.GetLocalDepth(FVector(100.0f, 0.0f, 0.0f)) == 0.0f);
+		CHECK(Shape.GetLocalDepth(FVector(0.0f, 0.0f, 350.0f)) < 0.0f);
+		CHECK(Shape.GetLocalExtent() == Shape.BoxExtent);
+	}
+
+	SECTION("Sphere")
+	{
+		Shape.Type = ELocalLightingShapeType::Sphere;
+		Shape.SphereRadius = 100.0f;
+		CHECK(Shape.GetLocalDepth(FVector(60.0f, 0.0f, 0.0f)) == 40.0f);
+		CHECK(Shape.GetLocalDepth(FVector(60.0f, 80.0f, 10.0f)) < 0.0f);
+		CHECK(Shape.GetLocalExtent() == FVector(100.0f));
+	}
+
+	SECTION("Capsule")
+	{
+		Shape.Type = ELocalLightingShapeType::Capsule;
+		Shape.CapsuleRadius = 50.0f;
+		Shape.CapsuleHalfHeight = 150.0f;
+		// The caps are hemispheres around the ends of the segment, not the corners of a cylinder.
+		CHECK(Shape.GetLocalDepth(FVector(0.0f, 0.0f, 100.0f)) == 50.0f);
+		CHECK(Shape.GetLocalDepth(FVector(0.0f, 0.0f, 150.0f)) == 0.0f);
+		CHECK(Shape.GetLocalDepth(FVector(45.0f, 0.0f, 145.0f)) < 0.0f);
+		CHECK(Shape.GetLocalExtent() == FVector(50.0f, 50.0f, 150.0f));
+	}
+
+	SECTION("Blend weight")
+	{
+		CHECK(FLocalLightingShape::GetBlendWeight(-10.0f, 100.0f) == 0.0f);
+		CHECK(FLocalLightingShape::GetBlendWeight(25.0f, 100.0f) == 0.25f);
+		CHECK(FLocalLightingShape::GetBlendWeight(250.0f, 100.0f) == 1.0f);
+		CHECK(FLocalLightingShape::GetBlendWeight(-10.0f, 0.0f) == 1.0f);
+	}
+}
+
+TEST_CASE("LocalLightingVolume::Core::ShapeInstances::Containment", "[LocalLightingVolume][Core]")
+{
+	FLocalLightingShape Shape;
+	Shape.Type = ELocalLightingShapeType::Sphere;
+	Shape.SphereRadius = 100.0f;
+
+	const FTransform InstanceToWorlds[] =
+	{
+		FTransform(FVector(0.0f, 0.0f, 0.0f)),
+		FTransform(FVector(150.0f, 0.0f, 0.0f)),
+		FTransform(FQuat::Identity, FVector(1000.0f, 0.0f, 0.0f), FVector(2.0f)),
+	};
+	FLocalLightingShapeInstances Instances;
+	Instances.Rebuild(InstanceToWorlds, Shape.GetLocalExtent());
+	REQUIRE(Instances.Num() == 3);
+
+	CHECK(Instances.Encompasses(Shape, FVector(-50.0f, 0.0f, 0.0f)));
+	CHECK(Instances.Encompasses(Shape, FVector(230.0f, 0.0f, 0.0f)));
+	CHECK(!Instances.Encompasses(Shape, FVector(500.0f, 0.0f, 0.0f)));
+	// The third instance is scaled, its local Shape reaches 200 in world space.
+	CHECK(Instances.Encompasses(Shape, FVector(1180.0f, 0.0f, 0.0f)));
+	CHECK(!Instances.Encompasses(Shape, FVector(0.0f, 0.0f, 5000.0f)));
+
+	// Overlapping instances form one region, the deepest one counts.
+	CHECK(Instances.GetMaxDepth(Shape, FVector(75.0f, 0.0f, 0.0f)) == 25.0f);
+	CHECK(Instances.GetMaxDepth(Shape, FVector(140.0f, 0.0f, 0.0f)) == 90.0f);
+	CHECK(Instances.GetMaxDepth(Shape, FVector(500.0f, 0.0f, 0.0f)) == 0.0f);
+
+	const int32 FirstIndex = Instances.Add(MakeArrayView(InstanceToWorlds, 1), Shape.GetLocalExtent());
+	CHECK(FirstIndex == 3);
+	Instances.Reset();
+	CHECK(Instances.Num() == 0);
+	CHECK(!Instances.Encompasses(Shape, FVector::ZeroVector));
+}
+
+TEST_CASE("LocalLightingVolume::Core::CandidateFilter", "[LocalLightingVolume][Core]")
+{
+	FLocalLightingCandidateFilter Filter;
+	CHECK(Filter.Add(FBox(FVector(-100.0f), FVector(100.0f))) == 0);
+	CHECK(Filter.Add(FBox(FVector(0.0f), FVector(300.0f))) == 1);
+	CHECK(Filter.Add(FBox(ForceInit)) == 2);
+	CHECK(Filter.Add(FBox(FVector(1000.0f), FVector(2000.0f))) == 3);
+
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	Filter.GatherCandidates(FVector(50.0f), Candidates);
+	CHECK(Candidates == TArray<int32, TInlineAllocator<64>>({ 0, 1 }));
+
+	SECTION("Invalid bounds contain nothing")
+	{
+		CHECK(!Filter.IsCandidate(2, FVector::ZeroVector));
+	}
+
+	SECTION("Moved bounds")
+	{
+		Filter.SetBounds(0, FBox(FVector(5000.0f), FVector(6000.0f)));
+		Candidates.Reset();
+		Filter.GatherCandidates(FVector(50.0f), Candidates);
+		CHECK(Candidates == TArray<int32, TInlineAllocator<64>>({ 1 }));
+	}
+
+	SECTION("Swap-remove mirrors the dense Volumes")
+	{
+		Filter.RemoveAtSwap(0);
+		REQUIRE(Filter.Num() == 3);
+		CHECK(Filter.GetBounds(0) == FBox(FVector(1000.0f), FVector(2000.0f)));
+		CHECK(Filter.IsCandidate(0, FVector(1500.0f)));
+		CHECK(!Filter.IsCandidate(1, FVector(-50.0f)));
+	}
+}
+
+TEST_CASE("LocalLightingVolume::Core::OverrideStack", "[LocalLightingVolume][Core]")
+{
+	TLocalLightingOverrideStack<int32, float> Stack;
+	CHECK(Stack.IsEmpty());
+
+	CHECK(Stack.Push(1, 10.0f) == 10.0f);
+	CHECK(Stack.Push(2, 20.0f) == 20.0f);
+	CHECK(Stack.Push(3, 30.0f) == 30.0f);
+	CHECK(Stack.Num() == 3);
+
+	SECTION("The last pushed override wins")
+	{
+		// Pushing again moves the override of the owner on top, replacing its value.
+		CHECK(Stack.Push(1, 15.0f) == 15.0f);
+		CHECK(Stack.Num() == 3);
+		CHECK(Stack.Top() == 15.0f);
+	}
+
+	SECTION("Owners leave in any order")
+	{
+		CHECK(Stack.Remove(2) == ELocalLightingOverrideStackChange::None);
+		CHECK(Stack.Top() == 30.0f);
+		CHECK(Stack.Remove(3) == ELocalLightingOverrideStackChange::Top);
+		CHECK(Stack.Top() == 10.0f);
+		CHECK(Stack.Remove(4) == ELocalLightingOverrideStackChange::None);
+		CHECK(Stack.Remove(1) == ELocalLightingOverrideStackChange::Baseline);
+		CHECK(Stack.IsEmpty());
+	}
+
+	SECTION("Values in push order")
+	{
+		TArray<float> Values;
+		Stack.ForEachValue([&Values](float Value)
+		{
+			Values.Add(Value);
+		});
+		CHECK(Values == TArray<float>({ 10.0f, 20.0f, 30.0f }));
+	}
+}
+
+TEST_CASE("LocalLightingVolume::Core::OverrideDiff", "[LocalLightingVolume][Core]")
+{
+	FLocalLightingOverridePayload From;
+	From.Add(TEXT("Intensity"), TEXT("1.000000"));
+	From.Add(TEXT("LightColor"), TEXT("(B=255,G=255,R=255,A=255)"));
+	From.Add(TEXT("CastShadows"), TEXT("True"));
+
+	SECTION("Identical payloads")
+	{
+		CHECK(FLocalLightingOverrideDiff::Compute(From, From).IsEmpty());
+	}
+
+	SECTION("Added, removed and changed overrides")
+	{
+		FLocalLightingOverridePayload To = From;
+		To.Remove(TEXT("CastShadows"));
+		To[TEXT("Intensity")] = TEXT("2.000000");
+		To.Add(TEXT("IndirectLightingIntensity"), TEXT("0.500000"));
+
+		const FLocalLightingOverrideDiff Diff = FLocalLightingOverrideDiff::Compute(From, To);
+		CHECK(!Diff.IsEmpty());
+		CHECK(Diff.Added == TArray<FName>({ TEXT("IndirectLightingIntensity") }));
+		CHECK(Diff.Removed == TArray<FName>({ TEXT("CastShadows") }));
+		CHECK(Diff.Changed == TArray<FName>({ TEXT("Intensity") }));
+	}
+}